@@ -0,0 +1,202 @@
+package com.anonymous.YellPay
+
+import android.os.SystemClock
+import com.facebook.react.bridge.ReadableMap
+import com.facebook.react.bridge.WritableMap
+import com.facebook.react.bridge.WritableNativeArray
+import com.facebook.react.bridge.WritableNativeMap
+
+/**
+ * Per-operation circuit breaker. Outcomes of the last [Spec.windowSize] calls decide
+ * when to open; an open breaker rejects calls until its cool-down elapses, then lets
+ * [Spec.halfOpenProbes] calls through. Probe success closes it, probe failure re-opens
+ * it with a doubled cool-down. The spec comes from JS (src/constants/circuitBreaker.ts)
+ * so Android and iOS share the same thresholds.
+ */
+object YellPayCircuitBreaker {
+
+    /**
+     * Read-only calls gated by the breaker (same set as iOS). Auth and payment flows always
+     * run, and their outcomes are never recorded, so they cannot show up as blocked.
+     */
+    val gatedOperations = setOf(
+        "getHistory", "cardSelect", "getMainCreditCard", "getUserInfo", "viewCertificate",
+        "getNotification", "getInformation", "getConfirmLimitAmount", "validateAuthenticationStatus"
+    )
+
+    data class Spec(
+        val windowSize: Int = 20,
+        val minimumCalls: Int = 5,
+        val failureRateThreshold: Double = 0.5,
+        val baseCooldownMs: Long = 5_000,
+        val maxCooldownMs: Long = 300_000,
+        val halfOpenProbes: Int = 1
+    ) {
+        companion object {
+            fun from(raw: ReadableMap): Spec {
+                val defaults = Spec()
+                fun number(key: String): Double? = if (raw.hasKey(key) && !raw.isNull(key)) raw.getDouble(key) else null
+                return Spec(
+                    windowSize = maxOf(1, number("windowSize")?.toInt() ?: defaults.windowSize),
+                    minimumCalls = maxOf(1, number("minimumCalls")?.toInt() ?: defaults.minimumCalls),
+                    failureRateThreshold = number("failureRateThreshold") ?: defaults.failureRateThreshold,
+                    baseCooldownMs = number("baseCooldownMs")?.toLong() ?: defaults.baseCooldownMs,
+                    maxCooldownMs = number("maxCooldownMs")?.toLong() ?: defaults.maxCooldownMs,
+                    halfOpenProbes = maxOf(1, number("halfOpenProbes")?.toInt() ?: defaults.halfOpenProbes)
+                )
+            }
+        }
+    }
+
+    enum class State(val label: String) {
+        CLOSED("closed"),
+        OPEN("open"),
+        HALF_OPEN("half-open")
+    }
+
+    private class Circuit {
+        var state = State.CLOSED
+        val outcomes = ArrayDeque<Boolean>()   // true = failure, oldest first
+        var trips = 0                          // consecutive opens without a full recovery
+        var openedAt = 0L
+        var probesInFlight = 0
+        var probeSuccesses = 0
+
+        val failures: Int
+            get() = outcomes.count { it }
+    }
+
+    private val lock = Any()
+    private var spec = Spec()
+
+    // Swapped by the JVM unit tests for a manual clock
+    internal var clock: () -> Long = { SystemClock.elapsedRealtime() }
+    private val circuits = HashMap<String, Circuit>()
+
+    fun configure(spec: Spec) {
+        synchronized(lock) { this.spec = spec }
+    }
+
+    private fun cooldownMs(circuit: Circuit): Long {
+        val multiplier = 1L shl minOf(30, maxOf(0, circuit.trips - 1))
+        return minOf(spec.maxCooldownMs, spec.baseCooldownMs * multiplier)
+    }
+
+    // Must hold lock
+    private fun transition(key: String, circuit: Circuit, state: State) {
+        if (circuit.state == state) return
+        circuit.state = state
+        when (state) {
+            State.OPEN -> {
+                circuit.trips++
+                circuit.openedAt = clock()
+            }
+            State.HALF_OPEN -> {
+                circuit.openedAt = clock()
+                circuit.probesInFlight = 0
+                circuit.probeSuccesses = 0
+            }
+            State.CLOSED -> {
+                circuit.trips = 0
+                circuit.outcomes.clear()
+            }
+        }
+        YellPayMetrics.recordBreakerTransition(key, state.label)
+        android.util.Log.d("YellPay", "Circuit $key -> ${state.label}")
+    }
+
+    /** False while the circuit is open (or half-open with all probe slots taken) */
+    fun allow(key: String): Boolean = synchronized(lock) {
+        val circuit = circuits.getOrPut(key) { Circuit() }
+        val now = clock()
+        if (circuit.state == State.OPEN) {
+            if (now - circuit.openedAt < cooldownMs(circuit)) return false
+            transition(key, circuit, State.HALF_OPEN)
+        }
+        if (circuit.state == State.HALF_OPEN) {
+            // A probe that never reported back (rejected before reaching the SDK) frees its slot after a cool-down
+            if (circuit.probesInFlight >= spec.halfOpenProbes && now - circuit.openedAt >= cooldownMs(circuit)) {
+                circuit.openedAt = now
+                circuit.probesInFlight = 0
+            }
+            if (circuit.probesInFlight >= spec.halfOpenProbes) return false
+            circuit.probesInFlight++
+        }
+        true
+    }
+
+    /** Frees the half-open probe slot of a call that ended without an outcome (caller or user cancel) */
+    fun release(key: String) {
+        if (key !in gatedOperations) return
+        synchronized(lock) {
+            val circuit = circuits[key] ?: return
+            if (circuit.state == State.HALF_OPEN) circuit.probesInFlight = maxOf(0, circuit.probesInFlight - 1)
+        }
+    }
+
+    fun record(key: String, failed: Boolean) {
+        if (key !in gatedOperations) return
+        synchronized(lock) {
+            val circuit = circuits.getOrPut(key) { Circuit() }
+            when (circuit.state) {
+                State.HALF_OPEN -> {
+                    if (failed) {
+                        transition(key, circuit, State.OPEN)
+                    } else {
+                        circuit.probeSuccesses++
+                        if (circuit.probeSuccesses >= spec.halfOpenProbes) {
+                            transition(key, circuit, State.CLOSED)
+                        }
+                    }
+                }
+                State.CLOSED -> {
+                    circuit.outcomes.addLast(failed)
+                    while (circuit.outcomes.size > spec.windowSize) circuit.outcomes.removeFirst()
+                    if (circuit.outcomes.size >= spec.minimumCalls &&
+                        circuit.failures.toDouble() / circuit.outcomes.size >= spec.failureRateThreshold
+                    ) {
+                        transition(key, circuit, State.OPEN)
+                    }
+                }
+                // Late result of a call that started before the circuit opened
+                State.OPEN -> Unit
+            }
+        }
+    }
+
+    fun reset() {
+        synchronized(lock) {
+            circuits.forEach { (key, circuit) ->
+                if (circuit.state != State.CLOSED) YellPayMetrics.recordBreakerTransition(key, State.CLOSED.label)
+            }
+            circuits.clear()
+        }
+    }
+
+    /** Writes blockedOperations, operationAttempts (failures in window) and per-circuit state into [target] */
+    fun writeStatus(target: WritableMap) {
+        synchronized(lock) {
+            val blocked = WritableNativeArray()
+            val failures = WritableNativeMap()
+            val states = WritableNativeMap()
+            val now = clock()
+            circuits.forEach { (key, circuit) ->
+                failures.putInt(key, circuit.failures)
+                if (circuit.state == State.OPEN) blocked.pushString(key)
+                states.putMap(key, WritableNativeMap().apply {
+                    putString("state", circuit.state.label)
+                    putInt("failures", circuit.failures)
+                    putInt("calls", circuit.outcomes.size)
+                    putInt("trips", circuit.trips)
+                    putDouble(
+                        "retryInMs",
+                        if (circuit.state == State.OPEN) maxOf(0L, cooldownMs(circuit) - (now - circuit.openedAt)).toDouble() else 0.0
+                    )
+                })
+            }
+            target.putArray("blockedOperations", blocked)
+            target.putMap("operationAttempts", failures)
+            target.putMap("circuits", states)
+        }
+    }
+}
@@ -0,0 +1,126 @@
+package com.anonymous.YellPay
+
+import android.os.Handler
+import android.os.Looper
+import android.os.SystemClock
+import java.util.concurrent.Executors
+import java.util.concurrent.ScheduledFuture
+import java.util.concurrent.TimeUnit
+
+/**
+ * Shared timeout tracking for bridge calls. One timer wheel ticking on a single
+ * scheduler thread services every pending deadline, so a call costs one table entry
+ * instead of its own Runnable posted to the main Handler. Each call is claimed exactly
+ * once: whichever of the SDK callback, failure path or timeout removes it from the
+ * pending table first wins, and every later claim is refused.
+ */
+object YellPayCompletionEngine {
+
+    class Call internal constructor(private val id: Long) {
+        /** True exactly once per call; callers bail out on false */
+        fun complete(): Boolean = claim(id, failed = false)
+
+        /** Same as [complete] for SDK failure paths; also counts a failure for the operation */
+        fun fail(): Boolean = claim(id, failed = true)
+
+        /**
+         * Claims an abandoned call (caller or user cancelled); counts neither success nor failure
+         * and frees any half-open probe slot it held
+         */
+        fun cancel(): Boolean = claim(id, failed = null)
+    }
+
+    private class Entry(val operation: String, val startMs: Long, val deadlineTick: Long, val onTimeout: () -> Unit)
+
+    // 250 ms resolution, 256 slots ≈ 64 s per revolution; longer deadlines wait extra rounds
+    private const val TICK_MS = 250L
+    private const val SLOT_COUNT = 256
+
+    private val lock = Any()
+    private val slots = Array(SLOT_COUNT) { ArrayList<Long>() }
+    private val pending = HashMap<Long, Entry>()
+    private var processedTick = 0L
+    private var nextId = 0L
+    private var ticker: ScheduledFuture<*>? = null
+
+    private val scheduler = Executors.newSingleThreadScheduledExecutor { runnable ->
+        Thread(runnable, "yellpay-completion-engine").apply { isDaemon = true }
+    }
+    private val mainHandler = Handler(Looper.getMainLooper())
+
+    // Swapped by the JVM unit tests for a manual clock and direct execution
+    internal var clock: () -> Long = { SystemClock.elapsedRealtime() }
+    internal var postToMain: (Runnable) -> Unit = { mainHandler.post(it) }
+
+    private val startMs = clock()
+
+    private fun currentTick(): Long = (clock() - startMs) / TICK_MS
+
+    /**
+     * Registers a call whose [onTimeout] runs on main if nothing claims it within [timeoutMs].
+     * Latency, failures and timeouts are reported to YellPayMetrics under [operation], and to
+     * YellPayCircuitBreaker when [operation] is one of its gated operations.
+     */
+    fun begin(operation: String, timeoutMs: Long, onTimeout: () -> Unit): Call = synchronized(lock) {
+        val id = ++nextId
+        val now = currentTick()
+        if (pending.isEmpty()) {
+            // Wheel was idle; skip the empty slots instead of walking them on the next tick
+            processedTick = maxOf(processedTick, now)
+        }
+        val deadline = now + maxOf(1L, (timeoutMs + TICK_MS - 1) / TICK_MS)
+        pending[id] = Entry(operation, clock(), deadline, onTimeout)
+        slots[(deadline % SLOT_COUNT).toInt()].add(id)
+        if (ticker == null) {
+            ticker = scheduler.scheduleAtFixedRate(::advance, TICK_MS, TICK_MS, TimeUnit.MILLISECONDS)
+        }
+        Call(id)
+    }
+
+    private fun claim(id: Long, failed: Boolean?): Boolean {
+        val entry = synchronized(lock) { pending.remove(id) } ?: return false
+        if (failed == null) {
+            YellPayCircuitBreaker.release(entry.operation)
+            return true
+        }
+        YellPayMetrics.recordLatency(entry.operation, (clock() - entry.startMs).toDouble())
+        if (failed) YellPayMetrics.recordError(entry.operation)
+        YellPayCircuitBreaker.record(entry.operation, failed)
+        return true
+    }
+
+    val pendingCount: Int
+        get() = synchronized(lock) { pending.size }
+
+    // Runs on the scheduler thread (and directly from the unit tests): walks every slot passed since the last tick
+    internal fun advance() {
+        val expired = ArrayList<Entry>()
+        synchronized(lock) {
+            val target = currentTick()
+            while (processedTick < target) {
+                processedTick++
+                val tick = processedTick
+                slots[(tick % SLOT_COUNT).toInt()].removeAll { id ->
+                    val entry = pending[id] ?: return@removeAll true
+                    if (entry.deadlineTick > tick) return@removeAll false
+                    pending.remove(id)
+                    expired.add(entry)
+                    true
+                }
+            }
+            if (pending.isEmpty()) {
+                // Nothing left to time out: stop ticking and drop ids of calls that already completed
+                ticker?.cancel(false)
+                ticker = null
+                slots.forEach { it.clear() }
+            }
+        }
+        if (expired.isNotEmpty()) {
+            expired.forEach {
+                YellPayMetrics.recordTimeout(it.operation)
+                YellPayCircuitBreaker.record(it.operation, failed = true)
+            }
+            postToMain(Runnable { expired.forEach { it.onTimeout() } })
+        }
+    }
+}
@@ -0,0 +1,142 @@
+package com.anonymous.YellPay
+
+import okhttp3.Call
+import okhttp3.Callback
+import okhttp3.ConnectionPool
+import okhttp3.EventListener
+import okhttp3.OkHttpClient
+import okhttp3.Request
+import okhttp3.Response
+import java.io.IOException
+import java.net.InetSocketAddress
+import java.net.Proxy
+import java.util.concurrent.ConcurrentHashMap
+import java.util.concurrent.TimeUnit
+import java.util.concurrent.atomic.AtomicInteger
+import java.util.concurrent.atomic.AtomicLong
+
+/**
+ * Keeps one long-lived OkHttp client (and connection pool) per backend environment and
+ * pre-warms it (DNS, TCP, TLS) before latency-sensitive SDK calls such as main card lookup
+ * followed by payment. An EventListener counts real handshakes versus reused connections
+ * so the effect can be checked from JS.
+ */
+object YellPayConnectionPool {
+
+    /** Do not re-warm an environment more often than this */
+    private const val MIN_WARMUP_INTERVAL_MS = 30_000L
+
+    private class Counters {
+        val warmups = AtomicInteger(0)
+        val failures = AtomicInteger(0)
+        val handshakes = AtomicInteger(0)
+        val reusedConnections = AtomicInteger(0)
+        val lastWarmupAt = AtomicLong(0)
+        @Volatile var lastHandshakeMs: Long = -1
+    }
+
+    private val clients = ConcurrentHashMap<String, OkHttpClient>()
+    private val counters = ConcurrentHashMap<String, Counters>()
+
+    /** Backend hosts used by each environment mode */
+    fun hosts(environment: String): List<String> = when (environment) {
+        "Production" -> listOf(YellPayModule.authDomain, YellPayModule.PAYMENT_DOMAIN)
+        else -> emptyList()
+    }
+
+    private fun countersFor(environment: String) = counters.getOrPut(environment) { Counters() }
+
+    private fun clientFor(environment: String): OkHttpClient = clients.getOrPut(environment) {
+        val stats = countersFor(environment)
+        OkHttpClient.Builder()
+            .connectionPool(ConnectionPool(4, 5, TimeUnit.MINUTES))
+            .callTimeout(10, TimeUnit.SECONDS)
+            .eventListenerFactory {
+                object : EventListener() {
+                    private var connected = false
+                    private var secureStartNs = 0L
+                    private var requestStartNs = 0L
+
+                    override fun connectStart(call: Call, inetSocketAddress: InetSocketAddress, proxy: Proxy) {
+                        connected = true
+                    }
+
+                    override fun secureConnectStart(call: Call) {
+                        secureStartNs = System.nanoTime()
+                    }
+
+                    override fun secureConnectEnd(call: Call, handshake: okhttp3.Handshake?) {
+                        stats.handshakes.incrementAndGet()
+                        stats.lastHandshakeMs = (System.nanoTime() - secureStartNs) / 1_000_000
+                    }
+
+                    override fun connectionAcquired(call: Call, connection: okhttp3.Connection) {
+                        if (!connected) stats.reusedConnections.incrementAndGet()
+                    }
+
+                    override fun requestHeadersStart(call: Call) {
+                        requestStartNs = System.nanoTime()
+                    }
+
+                    override fun responseHeadersStart(call: Call) {
+                        YellPayMetrics.recordTimeToFirstByte("warmUpConnections", (System.nanoTime() - requestStartNs) / 1_000_000.0)
+                    }
+
+                    override fun requestHeadersEnd(call: Call, request: Request) {
+                        YellPayMetrics.recordBytes("warmUpConnections", request.headers.byteCount())
+                    }
+
+                    override fun responseHeadersEnd(call: Call, response: Response) {
+                        YellPayMetrics.recordBytes("warmUpConnections", response.headers.byteCount())
+                    }
+
+                    override fun responseBodyEnd(call: Call, byteCount: Long) {
+                        YellPayMetrics.recordBytes("warmUpConnections", byteCount)
+                    }
+                }
+            }
+            .build()
+    }
+
+    /**
+     * Opens (or keeps alive) connections to every host of the environment.
+     * Returns false when the environment was warmed recently and nothing was sent.
+     */
+    fun warmUp(environment: String, force: Boolean = false): Boolean {
+        val hosts = hosts(environment)
+        if (hosts.isEmpty()) return false
+
+        val stats = countersFor(environment)
+        val now = System.currentTimeMillis()
+        val last = stats.lastWarmupAt.get()
+        if (!force && now - last < MIN_WARMUP_INTERVAL_MS) return false
+        if (!stats.lastWarmupAt.compareAndSet(last, now)) return false
+        stats.warmups.incrementAndGet()
+
+        val client = clientFor(environment)
+        hosts.forEach { host ->
+            val request = Request.Builder().url("https://$host/").head().build()
+            client.newCall(request).enqueue(object : Callback {
+                override fun onFailure(call: Call, e: IOException) {
+                    stats.failures.incrementAndGet()
+                }
+
+                override fun onResponse(call: Call, response: Response) {
+                    response.close()
+                }
+            })
+        }
+        return true
+    }
+
+    fun snapshot(): Map<String, Map<String, Any?>> = counters.mapValues { (_, stats) ->
+        mapOf(
+            "warmups" to stats.warmups.get(),
+            "failures" to stats.failures.get(),
+            "handshakes" to stats.handshakes.get(),
+            "handshakesAvoided" to stats.reusedConnections.get(),
+            "lastWarmupAt" to stats.lastWarmupAt.get().takeIf { it > 0 }?.toDouble(),
+            "lastHandshakeMs" to stats.lastHandshakeMs.takeIf { it >= 0 }?.toDouble()
+        )
+    }
+}
@@ -0,0 +1,124 @@
+package com.anonymous.YellPay
+
+import com.facebook.react.bridge.WritableMap
+import com.facebook.react.bridge.WritableNativeArray
+import com.facebook.react.bridge.WritableNativeMap
+
+/**
+ * In-process instrumentation for bridge calls. Latencies go into fixed log-scale
+ * histograms (no per-sample storage), so recording is O(1) and a snapshot for JS
+ * reports p50/p95/p99 per method along with error, timeout and circuit-breaker
+ * counts. Percentiles are the upper bound of the bucket holding that rank.
+ */
+object YellPayMetrics {
+
+    // Bucket upper bounds in milliseconds; the last bucket is open-ended
+    private val BUCKET_BOUNDS_MS = doubleArrayOf(1.0, 2.0, 5.0, 10.0, 20.0, 50.0, 100.0, 200.0, 500.0, 1_000.0, 2_000.0, 5_000.0, 10_000.0, 20_000.0, 30_000.0, 60_000.0)
+    private const val MAX_TRANSITIONS = 50
+
+    private class Histogram {
+        val buckets = IntArray(BUCKET_BOUNDS_MS.size + 1)
+        var count = 0
+        var sumMs = 0.0
+        var maxMs = 0.0
+
+        fun record(ms: Double) {
+            val index = BUCKET_BOUNDS_MS.indexOfFirst { ms <= it }.let { if (it < 0) BUCKET_BOUNDS_MS.size else it }
+            buckets[index]++
+            count++
+            sumMs += ms
+            maxMs = maxOf(maxMs, ms)
+        }
+
+        fun percentile(p: Double): Double {
+            if (count == 0) return 0.0
+            val rank = Math.ceil(count * p).toInt()
+            var seen = 0
+            buckets.forEachIndexed { index, bucketCount ->
+                seen += bucketCount
+                if (seen >= rank) return if (index < BUCKET_BOUNDS_MS.size) BUCKET_BOUNDS_MS[index] else maxMs
+            }
+            return maxMs
+        }
+
+        fun toWritableMap(): WritableMap = WritableNativeMap().apply {
+            putInt("count", count)
+            putDouble("p50", percentile(0.50))
+            putDouble("p95", percentile(0.95))
+            putDouble("p99", percentile(0.99))
+            putDouble("max", maxMs)
+            putDouble("mean", if (count > 0) sumMs / count else 0.0)
+        }
+    }
+
+    private class MethodStats {
+        val latency = Histogram()
+        val decode = Histogram()
+        val ttfb = Histogram()
+        var errors = 0
+        var timeouts = 0
+        var bytes = 0L
+    }
+
+    private class Transition(val method: String, val state: String, val at: Long)
+
+    private val lock = Any()
+    private val methods = HashMap<String, MethodStats>()
+    private val transitions = ArrayDeque<Transition>()
+
+    private inline fun update(method: String, body: (MethodStats) -> Unit) {
+        synchronized(lock) { body(methods.getOrPut(method) { MethodStats() }) }
+    }
+
+    fun recordLatency(method: String, ms: Double) = update(method) { it.latency.record(ms) }
+
+    fun recordDecode(method: String, ms: Double) = update(method) { it.decode.record(ms) }
+
+    fun recordTimeToFirstByte(method: String, ms: Double) = update(method) { it.ttfb.record(ms) }
+
+    fun recordBytes(method: String, bytes: Long) = update(method) { it.bytes += bytes }
+
+    fun recordError(method: String) = update(method) { it.errors++ }
+
+    fun recordTimeout(method: String) = update(method) { it.timeouts++ }
+
+    fun recordBreakerTransition(method: String, state: String) {
+        synchronized(lock) {
+            transitions.addLast(Transition(method, state, System.currentTimeMillis()))
+            while (transitions.size > MAX_TRANSITIONS) transitions.removeFirst()
+        }
+    }
+
+    fun snapshot(): WritableMap = synchronized(lock) {
+        val result = WritableNativeMap()
+        val methodsMap = WritableNativeMap()
+        methods.forEach { (method, stats) ->
+            methodsMap.putMap(method, WritableNativeMap().apply {
+                putMap("latencyMs", stats.latency.toWritableMap())
+                putMap("decodeMs", stats.decode.toWritableMap())
+                putMap("ttfbMs", stats.ttfb.toWritableMap())
+                putInt("errors", stats.errors)
+                putInt("timeouts", stats.timeouts)
+                putDouble("bytes", stats.bytes.toDouble())
+            })
+        }
+        val transitionArray = WritableNativeArray()
+        transitions.forEach { transition ->
+            transitionArray.pushMap(WritableNativeMap().apply {
+                putString("method", transition.method)
+                putString("state", transition.state)
+                putDouble("at", transition.at.toDouble())
+            })
+        }
+        result.putMap("methods", methodsMap)
+        result.putArray("breakerTransitions", transitionArray)
+        result
+    }
+
+    fun reset() {
+        synchronized(lock) {
+            methods.clear()
+            transitions.clear()
+        }
+    }
+}
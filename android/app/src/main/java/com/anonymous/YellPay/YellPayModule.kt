@@ -1,6 +1,7 @@
 package com.anonymous.YellPay
 
 import android.app.Activity
+import android.content.Intent
 import android.os.Build
 import android.os.Handler
 import android.os.Looper
@@ -12,7 +13,9 @@ import com.platfield.unidsdk.routecode.RouteAuth
 import com.platfield.unidsdk.routecode.RoutePay
 import com.platfield.unidsdk.routecode.EnvironmentMode
 import org.json.JSONObject
-import java.util.concurrent.atomic.AtomicBoolean
+import java.lang.ref.WeakReference
+import java.util.concurrent.ExecutorService
+import java.util.concurrent.Executors
 
 class YellPayModule(reactContext: ReactApplicationContext) : ReactContextBaseJavaModule(reactContext) {
 
@@ -20,6 +23,16 @@ class YellPayModule(reactContext: ReactApplicationContext) : ReactContextBaseJav
         const val AUTH_DOMAIN = "auth.unid.net"
         const val PAYMENT_DOMAIN = "dev-pay.unid.net"
         const val SERVICE_ID = "yellpay"
+
+        /**
+         * Debug builds may point RouteAuth at a local mock (server/routecodeMock.js).
+         * RoutePay picks its payment host from EnvironmentMode internally, so only auth can be redirected.
+         */
+        @Volatile
+        var authDomainOverride: String? = null
+
+        val authDomain: String
+            get() = authDomainOverride ?: AUTH_DOMAIN
     }
 
     override fun getName() = "YellPay"
@@ -54,24 +67,26 @@ class YellPayModule(reactContext: ReactApplicationContext) : ReactContextBaseJav
     }
 
     private fun withTimeout(
+        operation: String,
         promise: Promise,
         timeoutMs: Long,
         timeoutCode: String,
         timeoutMessage: String,
-        block: (completed: java.util.concurrent.atomic.AtomicBoolean, timeoutRunnable: Runnable) -> Unit
+        onTimeout: (() -> Unit)? = null,
+        block: (call: YellPayCompletionEngine.Call) -> Unit
     ) {
-        val completed = AtomicBoolean(false)
-        val timeoutRunnable = Runnable {
-            if (completed.compareAndSet(false, true)) {
-                resolveError(promise, timeoutCode, timeoutMessage)
-            }
+        if (operation in YellPayCircuitBreaker.gatedOperations && !YellPayCircuitBreaker.allow(operation)) {
+            resolveError(promise, "CIRCUIT_BREAKER_OPEN", "$operation has failed too many times; retry later")
+            return
+        }
+        val call = YellPayCompletionEngine.begin(operation, timeoutMs) {
+            onTimeout?.invoke()
+            resolveError(promise, timeoutCode, timeoutMessage)
         }
-        mainHandler.postDelayed(timeoutRunnable, timeoutMs)
         try {
-            block(completed, timeoutRunnable)
+            block(call)
         } catch (e: Exception) {
-            if (completed.compareAndSet(false, true)) {
-                mainHandler.removeCallbacks(timeoutRunnable)
+            if (call.fail()) {
                 promise.reject("SDK_CALL_ERROR", e.message ?: "Unexpected error", e)
             }
         }
@@ -90,7 +105,7 @@ class YellPayModule(reactContext: ReactApplicationContext) : ReactContextBaseJav
                 return
             }
             runOnMainThread {
-                withTimeout(promise, 20_000, "CARD_REGISTER_TIMEOUT", "Card registration timed out") { completed, timeoutRunnable ->
+                withTimeout("addCard", promise, 20_000, "CARD_REGISTER_TIMEOUT", "Card registration timed out") { call ->
                     try {
                         routePay.callCardRegister(
                             uuid,
@@ -100,23 +115,20 @@ class YellPayModule(reactContext: ReactApplicationContext) : ReactContextBaseJav
                             currentEnvironmentMode,
                             object : RoutePay.ResponseCardRegistCallback {
                                 override fun success(resultUuid: String, resultUserNo: Int) {
-                                    if (!completed.compareAndSet(false, true)) return
-                                    mainHandler.removeCallbacks(timeoutRunnable)
+                                    if (!call.complete()) return
                                     val response = WritableNativeMap()
                                     response.putString("uuid", resultUuid)
                                     response.putInt("userNo", resultUserNo)
                                     resolvePromiseSafe(promise, response)
                                 }
                                 override fun failed(errorCode: Int, errorMessage: String) {
-                                    if (!completed.compareAndSet(false, true)) return
-                                    mainHandler.removeCallbacks(timeoutRunnable)
+                                    if (!call.fail()) return
                                     resolveError(promise, "CARD_REGISTER_ERROR", "Card registration failed ($errorCode): $errorMessage")
                                 }
                             }
                         )
                     } catch (e: Exception) {
-                        if (!completed.compareAndSet(false, true)) return@withTimeout
-                        mainHandler.removeCallbacks(timeoutRunnable)
+                        if (!call.fail()) return@withTimeout
                         resolveError(promise, "CARD_REGISTER_SDK_ERROR", e.message ?: "SDK call failed")
                     }
                 }
@@ -135,13 +147,38 @@ class YellPayModule(reactContext: ReactApplicationContext) : ReactContextBaseJav
         }
     }
 
+    /** RoutePay calls that present no UI and are safe to run off the main thread */
+    private val uiFreeOperations = setOf("getUserInfo", "getNotification", "getInformation")
+
+    private val sdkExecutor: ExecutorService = Executors.newFixedThreadPool(4) { runnable ->
+        Thread(runnable, "yellpay-sdk").apply { isDaemon = true }
+    }
+
+    /** UI-free SDK calls (and their response decoding) run on sdkExecutor; everything else on main */
+    private fun runForOperation(operationKey: String, action: () -> Unit) {
+        if (operationKey in uiFreeOperations) {
+            sdkExecutor.execute(action)
+        } else {
+            runOnMainThread(action)
+        }
+    }
+
+    /** Runs SDK payload decoding on sdkExecutor and records how long it took */
+    private fun decodeOnExecutor(operationKey: String, decode: () -> Unit) {
+        sdkExecutor.execute {
+            val start = android.os.SystemClock.elapsedRealtime()
+            decode()
+            YellPayMetrics.recordDecode(operationKey, (android.os.SystemClock.elapsedRealtime() - start).toDouble())
+        }
+    }
+
     // ===== CONFIGURATION METHODS =====
 
     @ReactMethod
     fun getProductionConfig(promise: Promise) {
         try {
             val config = WritableNativeMap()
-            config.putString("authDomain", AUTH_DOMAIN)
+            config.putString("authDomain", authDomain)
             config.putString("paymentDomain", PAYMENT_DOMAIN)
             config.putString("serviceId", SERVICE_ID)
             config.putString("environmentMode", "Production")
@@ -151,6 +188,21 @@ class YellPayModule(reactContext: ReactApplicationContext) : ReactContextBaseJav
         }
     }
 
+    @ReactMethod
+    fun setAuthDomainOverride(domain: String, promise: Promise) {
+        if (!BuildConfig.DEBUG) {
+            promise.reject("UNSUPPORTED", "Auth domain override is only available in debug builds")
+            return
+        }
+        val safeDomain = domain.trim().filter { it.isLetterOrDigit() || it in ".-:" }.take(128)
+        authDomainOverride = safeDomain.ifEmpty { null }
+        android.util.Log.d("YellPay", "Auth domain: $authDomain")
+        val result = WritableNativeMap()
+        result.putString("authDomain", authDomain)
+        result.putBoolean("overridden", authDomainOverride != null)
+        resolvePromiseSafe(promise, result)
+    }
+
     @ReactMethod
     fun setEnvironment(mode: String, promise: Promise) {
         try {
@@ -174,10 +226,93 @@ class YellPayModule(reactContext: ReactApplicationContext) : ReactContextBaseJav
         resolvePromiseSafe(promise, result)
     }
 
+    // ===== CONNECTION METHODS =====
+
+    private fun currentEnvironmentName(): String =
+        if (currentEnvironmentMode == EnvironmentMode.Staging) "Staging" else "Production"
+
+    @ReactMethod
+    fun warmUpConnections(promise: Promise) {
+        try {
+            val environment = currentEnvironmentName()
+            val result = WritableNativeMap()
+            result.putString("environmentMode", environment)
+            result.putBoolean("started", YellPayConnectionPool.warmUp(environment, force = true))
+            resolvePromiseSafe(promise, result)
+        } catch (e: Exception) {
+            promise.reject("CONNECTION_ERROR", e.message ?: "Failed to warm up connections", e)
+        }
+    }
+
+    @ReactMethod
+    fun getConnectionStats(promise: Promise) {
+        try {
+            val result = WritableNativeMap()
+            YellPayConnectionPool.snapshot().forEach { (environment, stats) ->
+                val entry = WritableNativeMap()
+                stats.forEach { (key, value) -> putBatchValue(entry, key, value) }
+                result.putMap(environment, entry)
+            }
+            resolvePromiseSafe(promise, result)
+        } catch (e: Exception) {
+            promise.reject("CONNECTION_ERROR", e.message ?: "Failed to read connection stats", e)
+        }
+    }
+
+    // ===== CIRCUIT BREAKER METHODS =====
+
+    @ReactMethod
+    fun configureCircuitBreaker(spec: ReadableMap, promise: Promise) {
+        YellPayCircuitBreaker.configure(YellPayCircuitBreaker.Spec.from(spec))
+        val result = WritableNativeMap()
+        result.putBoolean("configured", true)
+        resolvePromiseSafe(promise, result)
+    }
+
+    @ReactMethod
+    fun resetCrashProtection(promise: Promise) {
+        YellPayCircuitBreaker.reset()
+        val result = WritableNativeMap()
+        result.putBoolean("reset", true)
+        result.putString("message", "All blocked operations have been reset")
+        resolvePromiseSafe(promise, result)
+    }
+
+    @ReactMethod
+    fun getCrashProtectionStatus(promise: Promise) {
+        val result = WritableNativeMap()
+        YellPayCircuitBreaker.writeStatus(result)
+        resolvePromiseSafe(promise, result)
+    }
+
+    // ===== METRICS METHODS =====
+
+    @ReactMethod
+    fun getMetricsSnapshot(promise: Promise) {
+        try {
+            val result = YellPayMetrics.snapshot()
+            result.putInt("pendingCalls", YellPayCompletionEngine.pendingCount)
+            YellPayCircuitBreaker.writeStatus(result)
+            resolvePromiseSafe(promise, result)
+        } catch (e: Exception) {
+            promise.reject("METRICS_ERROR", e.message ?: "Failed to read metrics", e)
+        }
+    }
+
+    @ReactMethod
+    fun resetMetrics(promise: Promise) {
+        YellPayMetrics.reset()
+        val result = WritableNativeMap()
+        result.putBoolean("reset", true)
+        resolvePromiseSafe(promise, result)
+    }
+
     // ===== AUTHENTICATION METHODS =====
 
     @ReactMethod
     fun authRegister(domainName: String, promise: Promise) {
+        // Authentication may switch users, so the cached main card is dropped
+        invalidateMainCard()
         try {
             val activity = getSafeCurrentActivity()
             if (activity == null) {
@@ -217,6 +352,8 @@ class YellPayModule(reactContext: ReactApplicationContext) : ReactContextBaseJav
 
     @ReactMethod
     fun authApproval(domainName: String, promise: Promise) {
+        // Authentication may switch users, so the cached main card is dropped
+        invalidateMainCard()
         try {
             val activity = getSafeCurrentActivity()
             if (activity == null) {
@@ -253,6 +390,8 @@ class YellPayModule(reactContext: ReactApplicationContext) : ReactContextBaseJav
 
     @ReactMethod
     fun authApprovalWithMode(domainName: String, isQrStart: Boolean, promise: Promise) {
+        // Authentication may switch users, so the cached main card is dropped
+        invalidateMainCard()
         // This method doesn't exist in the SDK, fallback to regular authApproval
         authApproval(domainName, promise)
     }
@@ -303,6 +442,8 @@ class YellPayModule(reactContext: ReactApplicationContext) : ReactContextBaseJav
 
     @ReactMethod
     fun autoAuthRegister(serviceId: String, userInfo: String, domainName: String, promise: Promise) {
+        // Authentication may switch users, so the cached main card is dropped
+        invalidateMainCard()
         try {
             val activity = getSafeCurrentActivity()
             if (activity == null) {
@@ -359,6 +500,8 @@ class YellPayModule(reactContext: ReactApplicationContext) : ReactContextBaseJav
 
     @ReactMethod
     fun autoAuthApproval(serviceId: String, domainName: String, promise: Promise) {
+        // Authentication may switch users, so the cached main card is dropped
+        invalidateMainCard()
         try {
             val activity = getSafeCurrentActivity()
             if (activity == null) {
@@ -422,22 +565,22 @@ class YellPayModule(reactContext: ReactApplicationContext) : ReactContextBaseJav
 
     @ReactMethod
     fun authRegisterProduction(promise: Promise) {
-        authRegister(AUTH_DOMAIN, promise)
+        authRegister(authDomain, promise)
     }
 
     @ReactMethod
     fun authApprovalProduction(promise: Promise) {
-        authApproval(AUTH_DOMAIN, promise)
+        authApproval(authDomain, promise)
     }
 
     @ReactMethod
     fun autoAuthRegisterProduction(userInfo: String, promise: Promise) {
-        autoAuthRegister(SERVICE_ID, userInfo, AUTH_DOMAIN, promise)
+        autoAuthRegister(SERVICE_ID, userInfo, authDomain, promise)
     }
 
     @ReactMethod
     fun autoAuthApprovalProduction(promise: Promise) {
-        autoAuthApproval(SERVICE_ID, AUTH_DOMAIN, promise)
+        autoAuthApproval(SERVICE_ID, authDomain, promise)
     }
 
     @ReactMethod
@@ -445,10 +588,235 @@ class YellPayModule(reactContext: ReactApplicationContext) : ReactContextBaseJav
         initUser(SERVICE_ID, promise)
     }
 
+    // ===== UI FLOW HANDLES =====
+
+    /**
+     * SDK flows that open their own screens, keyed by operation name. A timeout or
+     * cancelFlow brings the host activity back to the front, which finishes the SDK
+     * activities stacked above it. Main thread only.
+     */
+    private class UiFlow(
+        val call: YellPayCompletionEngine.Call,
+        val host: WeakReference<Activity>,
+        val onCancel: () -> Unit
+    )
+
+    private val uiFlows = HashMap<String, UiFlow>()
+
+    private fun trackFlow(name: String, call: YellPayCompletionEngine.Call, host: Activity, onCancel: () -> Unit) {
+        uiFlows[name] = UiFlow(call, WeakReference(host), onCancel)
+    }
+
+    /**
+     * Claims a failed SDK callback. A user dismissing the SDK screen is not an operation
+     * failure, so it settles the call like a cancel instead of counting against the breaker.
+     */
+    private fun claimFailure(call: YellPayCompletionEngine.Call, errorMessage: String?): Boolean {
+        val message = errorMessage.orEmpty()
+        return if (message.contains("cancelled") || message.contains("canceled")) call.cancel() else call.fail()
+    }
+
+    /** Forgets a flow that settled through its own SDK callback */
+    private fun finishFlow(name: String, call: YellPayCompletionEngine.Call) {
+        runOnMainThread {
+            if (uiFlows[name]?.call === call) uiFlows.remove(name)
+        }
+    }
+
+    private fun tearDownFlow(name: String): UiFlow? {
+        val flow = uiFlows.remove(name) ?: return null
+        val host = flow.host.get()
+        if (host != null && !host.isFinishing) {
+            try {
+                android.util.Log.d("YellPay", "$name - closing SDK screens")
+                host.startActivity(
+                    Intent(host, host.javaClass)
+                        .addFlags(Intent.FLAG_ACTIVITY_CLEAR_TOP or Intent.FLAG_ACTIVITY_SINGLE_TOP)
+                )
+            } catch (e: Exception) {
+                android.util.Log.e("YellPay", "$name - failed to close SDK screens: ${e.message}")
+            }
+        }
+        return flow
+    }
+
+    /**
+     * Cancels a running registerCard / makePayment / cardSelect flow; its promise rejects
+     * with FLOW_CANCELLED. Resolves false when the flow is not running.
+     */
+    @ReactMethod
+    fun cancelFlow(flow: String, promise: Promise) {
+        runOnMainThread {
+            val active = uiFlows[flow]
+            if (active == null || !active.call.cancel()) {
+                resolvePromiseSafe(promise, false)
+                return@runOnMainThread
+            }
+            tearDownFlow(flow)
+            active.onCancel()
+            resolvePromiseSafe(promise, true)
+        }
+    }
+
+    // ===== SINGLE-FLIGHT =====
+
+    // Callers waiting on an identical in-flight read, keyed by method + arguments
+    private val inFlight = HashMap<String, MutableList<Promise>>()
+
+    /**
+     * Returns null when an identical call is already running (the caller joins it);
+     * otherwise a promise that settles every joined caller with the one SDK result.
+     */
+    private fun singleFlight(key: String, caller: Promise): Promise? {
+        synchronized(inFlight) {
+            inFlight[key]?.let { waiters ->
+                waiters.add(caller)
+                android.util.Log.d("YellPay", "singleFlight - joined in-flight ${key.substringBefore('|')} (${waiters.size} waiting)")
+                return null
+            }
+            inFlight[key] = mutableListOf(caller)
+        }
+
+        fun drain(): List<Promise> = synchronized(inFlight) { inFlight.remove(key) ?: emptyList() }
+
+        return PromiseImpl(
+            { args ->
+                val waiters = drain()
+                val value = args.getOrNull(0)
+                // Bridge maps/arrays are consumed on resolve, so copy for every waiter before the first resolves.
+                // A failed copy rejects only that waiter; the others still get the result.
+                val values = waiters.indices.map { index ->
+                    if (index == 0) Result.success(value) else runCatching { copyBridgeValue(value) }
+                }
+                waiters.forEachIndexed { index, waiter ->
+                    values[index].fold(
+                        { resolvePromiseSafe(waiter, it) },
+                        { e -> rejectPromiseSafe(waiter, "SINGLE_FLIGHT_ERROR", e.message ?: "Failed to copy result") }
+                    )
+                }
+            },
+            { args ->
+                val error = args.getOrNull(0) as? ReadableMap
+                val code = error?.getString("code") ?: "SINGLE_FLIGHT_ERROR"
+                val message = error?.getString("message") ?: "Request failed"
+                drain().forEach { waiter -> rejectPromiseSafe(waiter, code, message) }
+            }
+        )
+    }
+
+    private fun rejectPromiseSafe(promise: Promise, code: String, message: String) {
+        try {
+            promise.reject(code, message)
+        } catch (e: Exception) {
+            android.util.Log.e("YellPay", "rejectPromiseSafe() - reject failed: ${e.message}")
+        }
+    }
+
+    // Element-by-element deep copy: Arguments.fromList rejects the HashMaps that toArrayList() produces
+    private fun copyBridgeValue(value: Any?): Any? = when (value) {
+        is ReadableMap -> WritableNativeMap().apply { merge(value) }
+        is ReadableArray -> copyBridgeArray(value)
+        else -> value
+    }
+
+    private fun copyBridgeArray(source: ReadableArray): WritableArray {
+        val copy = WritableNativeArray()
+        for (i in 0 until source.size()) {
+            when (source.getType(i)) {
+                ReadableType.Null -> copy.pushNull()
+                ReadableType.Boolean -> copy.pushBoolean(source.getBoolean(i))
+                ReadableType.Number -> copy.pushDouble(source.getDouble(i))
+                ReadableType.String -> copy.pushString(source.getString(i))
+                ReadableType.Map -> copy.pushMap(WritableNativeMap().apply { source.getMap(i)?.let { merge(it) } })
+                ReadableType.Array -> copy.pushArray(source.getArray(i)?.let { copyBridgeArray(it) } ?: WritableNativeArray())
+            }
+        }
+        return copy
+    }
+
+    // ===== MAIN CARD CACHE =====
+
+    private data class MainCard(
+        val payUserId: String,
+        val uuid: String,
+        val userNo: Int,
+        val creditCardNo: String,
+        val creditCardExp: String,
+        val fetchedAt: Long = System.currentTimeMillis()
+    ) {
+        fun toWritableMap(): WritableMap = WritableNativeMap().apply {
+            putString("uuid", uuid)
+            putInt("userNo", userNo)
+            putString("creditCardNo", creditCardNo)
+            putString("creditCardExp", creditCardExp)
+        }
+    }
+
+    /**
+     * Main card from the last lookup and the payUserId it belongs to; cleared whenever the user
+     * registers or selects a card, on any (re-)authentication or initUser, and by clearMainCardCache
+     */
+    @Volatile private var cachedMainCard: MainCard? = null
+
+    private val mainCardTtlMs = 5 * 60_000L
+
+    private fun freshMainCard(payUserId: String): MainCard? =
+        cachedMainCard?.takeIf { it.payUserId == payUserId && System.currentTimeMillis() - it.fetchedAt < mainCardTtlMs }
+
+    private fun invalidateMainCard() {
+        cachedMainCard = null
+    }
+
+    /** Drops the cached main card; call on logout so the next user never sees it */
+    @ReactMethod
+    fun clearMainCardCache(promise: Promise) {
+        invalidateMainCard()
+        resolvePromiseSafe(promise, true)
+    }
+
+    /**
+     * Speculative payment setup for idle screens: warms the backend connections and
+     * caches the main card so makePayment can open the payment UI without the
+     * main-card round trip. Never rejects; resolves { ready, cached, card? }.
+     */
+    @ReactMethod
+    fun preparePayment(payUserId: String, promise: Promise) {
+        YellPayConnectionPool.warmUp(currentEnvironmentName())
+
+        freshMainCard(payUserId)?.let { card ->
+            val result = WritableNativeMap()
+            result.putBoolean("ready", true)
+            result.putBoolean("cached", true)
+            result.putMap("card", card.toWritableMap())
+            resolvePromiseSafe(promise, result)
+            return
+        }
+
+        getMainCreditCard(payUserId, PromiseImpl(
+            { args ->
+                val result = WritableNativeMap()
+                result.putBoolean("ready", true)
+                result.putBoolean("cached", false)
+                putBatchValue(result, "card", args.getOrNull(0))
+                resolvePromiseSafe(promise, result)
+            },
+            { args ->
+                val error = args.getOrNull(0) as? ReadableMap
+                val result = WritableNativeMap()
+                result.putBoolean("ready", false)
+                result.putString("code", error?.getString("code") ?: "PREPARE_PAYMENT_ERROR")
+                result.putString("message", error?.getString("message") ?: "")
+                resolvePromiseSafe(promise, result)
+            }
+        ))
+    }
+
     // ===== PAYMENT METHODS =====
 
     @ReactMethod
     fun initUser(serviceId: String, promise: Promise) {
+        // Authentication may switch users, so the cached main card is dropped
+        invalidateMainCard()
         try {
             val activity = getSafeCurrentActivity()
             if (activity == null) {
@@ -456,7 +824,7 @@ class YellPayModule(reactContext: ReactApplicationContext) : ReactContextBaseJav
                 return
             }
 
-            withTimeout(promise, 20_000, "INIT_USER_TIMEOUT", "Initialize user timed out") { completed, timeoutRunnable ->
+            withTimeout("initUser", promise, 20_000, "INIT_USER_TIMEOUT", "Initialize user timed out") { call ->
                 routePay.callInitialUserId(
                     serviceId,
                     activity,
@@ -464,8 +832,7 @@ class YellPayModule(reactContext: ReactApplicationContext) : ReactContextBaseJav
                     object : RoutePay.ResponseInitialUserIdCallback {
                         override fun success(userId: String) {
                             try {
-                                if (!completed.compareAndSet(false, true)) return
-                                mainHandler.removeCallbacks(timeoutRunnable)
+                                if (!call.complete()) return
                                 promise.resolve(userId ?: "")
                             } catch (e: Exception) {
                                 promise.reject("INIT_CALLBACK_ERROR", "Error processing user ID: ${e.message}", e)
@@ -473,8 +840,7 @@ class YellPayModule(reactContext: ReactApplicationContext) : ReactContextBaseJav
                         }
 
                         override fun failed(errorCode: Int, errorMessage: String) {
-                            if (!completed.compareAndSet(false, true)) return
-                            mainHandler.removeCallbacks(timeoutRunnable)
+                            if (!call.fail()) return
                             promise.reject("INIT_USER_ERROR", "Error $errorCode: $errorMessage")
                         }
                     }
@@ -540,14 +906,14 @@ class YellPayModule(reactContext: ReactApplicationContext) : ReactContextBaseJav
                     
                     try {
                         // Timeout protection in case SDK never calls back
-                        val completed = AtomicBoolean(false)
-                        val timeoutRunnable = Runnable {
-                            if (completed.compareAndSet(false, true)) {
-                                android.util.Log.e("YellPay", "registerCard() - TIMEOUT waiting for SDK callback")
-                                promise.reject("CARD_REGISTER_TIMEOUT", "Card registration timed out after 20 seconds")
-                            }
+                        val call = YellPayCompletionEngine.begin("registerCard", 20_000) {
+                            android.util.Log.e("YellPay", "registerCard() - TIMEOUT waiting for SDK callback")
+                            tearDownFlow("registerCard")
+                            promise.reject("CARD_REGISTER_TIMEOUT", "Card registration timed out after 20 seconds")
+                        }
+                        trackFlow("registerCard", call, activity) {
+                            promise.reject("FLOW_CANCELLED", "registerCard was cancelled")
                         }
-                        mainHandler.postDelayed(timeoutRunnable, 20_000)
                         android.util.Log.d("YellPay", "registerCard() - Step 9: Calling routePay.callCardRegister() NOW...")
 
                         // Align to working example: treat payUserId (or uuid) as userId for SDK
@@ -560,9 +926,10 @@ class YellPayModule(reactContext: ReactApplicationContext) : ReactContextBaseJav
                             object : RoutePay.ResponseCardRegistCallback {
                                 override fun success(message: String, status: Int) {
                                     try {
-                                        if (!completed.compareAndSet(false, true)) return
-                                        mainHandler.removeCallbacks(timeoutRunnable)
+                                        if (!call.complete()) return
+                                        finishFlow("registerCard", call)
                                         android.util.Log.d("YellPay", "registerCard() - SDK SUCCESS CALLBACK - status: $status, message: $message")
+                                        invalidateMainCard()
                                         val response = WritableNativeMap()
                                         response.putInt("status", status)
                                         response.putString("message", message)
@@ -574,8 +941,8 @@ class YellPayModule(reactContext: ReactApplicationContext) : ReactContextBaseJav
                                 }
 
                                 override fun failed(errorCode: Int, errorMessage: String) {
-                                    if (!completed.compareAndSet(false, true)) return
-                                    mainHandler.removeCallbacks(timeoutRunnable)
+                                    if (!call.fail()) return
+                                    finishFlow("registerCard", call)
                                     android.util.Log.e("YellPay", "registerCard() - SDK FAILED CALLBACK - Code: $errorCode, Message: $errorMessage")
                                     promise.reject("CARD_REGISTER_ERROR", "Card registration failed (Code: $errorCode): $errorMessage")
                                 }
@@ -609,6 +976,8 @@ class YellPayModule(reactContext: ReactApplicationContext) : ReactContextBaseJav
         android.util.Log.d("YellPay", "=== MAKE PAYMENT METHOD CALLED ===")
         android.util.Log.d("YellPay", "makePayment() - Input UUID: '$uuid', UserNo: $userNo, PayUserId: '$payUserId'")
         
+        YellPayConnectionPool.warmUp(currentEnvironmentName())
+
         try {
             android.util.Log.d("YellPay", "makePayment() - Getting current activity...")
             val activity = getSafeCurrentActivity()
@@ -646,61 +1015,74 @@ class YellPayModule(reactContext: ReactApplicationContext) : ReactContextBaseJav
                 try {
                     android.util.Log.d("YellPay", "makePayment() - Calling routePay.callPayment()...")
                     // Timeout protection in case SDK never calls back
-                    val completed = AtomicBoolean(false)
-                    val timeoutRunnable = Runnable {
-                        if (completed.compareAndSet(false, true)) {
-                            android.util.Log.e("YellPay", "makePayment() - TIMEOUT waiting for SDK callback")
-                            resolveError(promise, "PAYMENT_TIMEOUT", "Payment timed out")
-                        }
+                    val call = YellPayCompletionEngine.begin("makePayment", 20_000) {
+                        android.util.Log.e("YellPay", "makePayment() - TIMEOUT waiting for SDK callback")
+                        tearDownFlow("makePayment")
+                        resolveError(promise, "PAYMENT_TIMEOUT", "Payment timed out")
+                    }
+                    trackFlow("makePayment", call, activity) {
+                        promise.reject("FLOW_CANCELLED", "makePayment was cancelled")
                     }
-                    mainHandler.postDelayed(timeoutRunnable, 20_000)
-
-                    // Align with working example: first get main card to obtain uuid/userNo, then call payment
-                    routePay.callGetMainCreditCard(
-                        activity,
-                        object : RoutePay.ResponseGetMainCreditCardCallback {
-                            override fun success(cardUuid: String, cardUserNo: Int, creditCardNo: String, creditCardExp: String) {
-                                android.util.Log.d("YellPay", "makePayment() - Got main card uuid=$cardUuid userNo=$cardUserNo")
-                                routePay.callPayment(
-                                    cardUuid,
-                                    cardUserNo,
-                                    payUserId,
-                                    activity,
-                                    currentEnvironmentMode,
-                                    object : RoutePay.ResponsePaymentCallback {
-                                        override fun success(message: String, status: Int) {
-                                            try {
-                                                if (!completed.compareAndSet(false, true)) return
-                                                mainHandler.removeCallbacks(timeoutRunnable)
-                                                android.util.Log.d("YellPay", "makePayment() - SDK SUCCESS CALLBACK - status: $status, message: $message")
-                                                val response = WritableNativeMap()
-                                                response.putInt("status", status)
-                                                response.putString("message", message)
-                                                resolvePromiseSafe(promise, response)
-                                            } catch (e: Exception) {
-                                                android.util.Log.e("YellPay", "makePayment() - Exception in success callback: ${e.message}", e)
-                                                resolveError(promise, "PAYMENT_CALLBACK_ERROR", e.message ?: "Callback error")
-                                            }
-                                        }
 
-                                        override fun failed(errorCode: Int, errorMessage: String?) {
-                                            if (!completed.compareAndSet(false, true)) return
-                                            mainHandler.removeCallbacks(timeoutRunnable)
-                                            android.util.Log.e("YellPay", "makePayment() - SDK FAILED CALLBACK - Code: $errorCode, Message: $errorMessage")
-                                            resolveError(promise, "PAYMENT_ERROR", "Payment failed ($errorCode): ${errorMessage ?: ""}")
-                                        }
+                    fun startPayment(cardUuid: String, cardUserNo: Int) {
+                        routePay.callPayment(
+                            cardUuid,
+                            cardUserNo,
+                            payUserId,
+                            activity,
+                            currentEnvironmentMode,
+                            object : RoutePay.ResponsePaymentCallback {
+                                override fun success(message: String, status: Int) {
+                                    try {
+                                        if (!call.complete()) return
+                                        finishFlow("makePayment", call)
+                                        android.util.Log.d("YellPay", "makePayment() - SDK SUCCESS CALLBACK - status: $status, message: $message")
+                                        val response = WritableNativeMap()
+                                        response.putInt("status", status)
+                                        response.putString("message", message)
+                                        resolvePromiseSafe(promise, response)
+                                    } catch (e: Exception) {
+                                        android.util.Log.e("YellPay", "makePayment() - Exception in success callback: ${e.message}", e)
+                                        resolveError(promise, "PAYMENT_CALLBACK_ERROR", e.message ?: "Callback error")
                                     }
-                                )
+                                }
+
+                                override fun failed(errorCode: Int, errorMessage: String?) {
+                                    // A stale main card is one possible cause; look it up again next time
+                                    invalidateMainCard()
+                                    if (!call.fail()) return
+                                    finishFlow("makePayment", call)
+                                    android.util.Log.e("YellPay", "makePayment() - SDK FAILED CALLBACK - Code: $errorCode, Message: $errorMessage")
+                                    resolveError(promise, "PAYMENT_ERROR", "Payment failed ($errorCode): ${errorMessage ?: ""}")
+                                }
                             }
+                        )
+                    }
 
-                            override fun failed(errorCode: Int, errorMessage: String) {
-                                if (!completed.compareAndSet(false, true)) return
-                                mainHandler.removeCallbacks(timeoutRunnable)
-                                android.util.Log.e("YellPay", "makePayment() - getMainCreditCard FAILED - Code: $errorCode, Message: $errorMessage")
-                                resolveError(promise, "MAIN_CARD_ERROR", "Get main card failed ($errorCode): $errorMessage")
+                    // Payment needs the main card's uuid/userNo; use the prepared one when available
+                    val preparedCard = freshMainCard(payUserId)
+                    if (preparedCard != null) {
+                        android.util.Log.d("YellPay", "makePayment() - Using cached main card uuid=${preparedCard.uuid} userNo=${preparedCard.userNo}")
+                        startPayment(preparedCard.uuid, preparedCard.userNo)
+                    } else {
+                        routePay.callGetMainCreditCard(
+                            activity,
+                            object : RoutePay.ResponseGetMainCreditCardCallback {
+                                override fun success(cardUuid: String, cardUserNo: Int, creditCardNo: String, creditCardExp: String) {
+                                    android.util.Log.d("YellPay", "makePayment() - Got main card uuid=$cardUuid userNo=$cardUserNo")
+                                    cachedMainCard = MainCard(payUserId, cardUuid, cardUserNo, creditCardNo, creditCardExp)
+                                    startPayment(cardUuid, cardUserNo)
+                                }
+
+                                override fun failed(errorCode: Int, errorMessage: String) {
+                                    if (!call.fail()) return
+                                    finishFlow("makePayment", call)
+                                    android.util.Log.e("YellPay", "makePayment() - getMainCreditCard FAILED - Code: $errorCode, Message: $errorMessage")
+                                    resolveError(promise, "MAIN_CARD_ERROR", "Get main card failed ($errorCode): $errorMessage")
+                                }
                             }
-                        }
-                    )
+                        )
+                    }
                     android.util.Log.d("YellPay", "makePayment() - SDK method call completed, waiting for callback...")
 
                 } catch (e: Exception) {
@@ -736,15 +1118,14 @@ class YellPayModule(reactContext: ReactApplicationContext) : ReactContextBaseJav
 
             // Using RouteCode SDK signature: callPayHistory(String payUserId, Activity activity, EnvironmentMode environmentMode, ResponseCallPayHistoryCallback callback)
             // The RouteCode SDK will show a full payment history UI screen
-            withTimeout(promise, 20_000, "HISTORY_TIMEOUT", "Get history timed out") { completed, timeoutRunnable ->
+            withTimeout("getHistory", promise, 20_000, "HISTORY_TIMEOUT", "Get history timed out") { call ->
                 routePay.callPayHistory(
                     userId,
                     activity,
                     currentEnvironmentMode,
                     object : RoutePay.ResponseCallPayHistoryCallback {
                         override fun success(payUserId: String) {
-                            if (!completed.compareAndSet(false, true)) return
-                            mainHandler.removeCallbacks(timeoutRunnable)
+                            if (!call.complete()) return
                             val response = WritableNativeMap()
                             response.putString("payUserId", payUserId)
                             response.putBoolean("screenDisplayed", true)
@@ -752,8 +1133,7 @@ class YellPayModule(reactContext: ReactApplicationContext) : ReactContextBaseJav
                         }
 
                         override fun failed(errorCode: Int, errorMessage: String) {
-                            if (!completed.compareAndSet(false, true)) return
-                            mainHandler.removeCallbacks(timeoutRunnable)
+                            if (!call.fail()) return
                             android.util.Log.e("YellPay", "Payment history failed - Code: $errorCode, Message: $errorMessage")
                             resolveError(promise, "HISTORY_ERROR", "Payment history failed ($errorCode): $errorMessage")
                         }
@@ -808,14 +1188,10 @@ class YellPayModule(reactContext: ReactApplicationContext) : ReactContextBaseJav
                 try {
                     android.util.Log.d("YellPay", "paymentForQR() - Calling routePay.callPaymentForQR()...")
                     // Timeout protection in case SDK never calls back
-                    val completed = AtomicBoolean(false)
-                    val timeoutRunnable = Runnable {
-                        if (completed.compareAndSet(false, true)) {
-                            android.util.Log.e("YellPay", "paymentForQR() - TIMEOUT waiting for SDK callback")
-                            resolveError(promise, "QR_PAYMENT_TIMEOUT", "QR payment timed out")
-                        }
+                    val call = YellPayCompletionEngine.begin("paymentForQR", 20_000) {
+                        android.util.Log.e("YellPay", "paymentForQR() - TIMEOUT waiting for SDK callback")
+                        resolveError(promise, "QR_PAYMENT_TIMEOUT", "QR payment timed out")
                     }
-                    mainHandler.postDelayed(timeoutRunnable, 20_000)
 
                     // Align to working example: fetch main card (uuid,userNo), then call QR with userId
                     val userIdForSdk = if (payUserId.isNotBlank()) payUserId else uuid
@@ -833,8 +1209,7 @@ class YellPayModule(reactContext: ReactApplicationContext) : ReactContextBaseJav
                                     object : RoutePay.ResponsePaymentCallback {
                                         override fun success(message: String, status: Int) {
                                             try {
-                                                if (!completed.compareAndSet(false, true)) return
-                                                mainHandler.removeCallbacks(timeoutRunnable)
+                                                if (!call.complete()) return
                                                 android.util.Log.d("YellPay", "paymentForQR() - SDK SUCCESS CALLBACK - status: $status, message: $message")
                                                 val response = WritableNativeMap()
                                                 response.putInt("status", status)
@@ -847,8 +1222,7 @@ class YellPayModule(reactContext: ReactApplicationContext) : ReactContextBaseJav
                                         }
 
                                         override fun failed(errorCode: Int, errorMessage: String?) {
-                                            if (!completed.compareAndSet(false, true)) return
-                                            mainHandler.removeCallbacks(timeoutRunnable)
+                                            if (!call.fail()) return
                                             android.util.Log.e("YellPay", "paymentForQR() - SDK FAILED CALLBACK - Code: $errorCode, Message: $errorMessage")
                                             resolveError(promise, "QR_PAYMENT_ERROR", "QR payment failed ($errorCode): ${errorMessage ?: ""}")
                                         }
@@ -857,8 +1231,7 @@ class YellPayModule(reactContext: ReactApplicationContext) : ReactContextBaseJav
                             }
 
                             override fun failed(errorCode: Int, errorMessage: String) {
-                                if (!completed.compareAndSet(false, true)) return
-                                mainHandler.removeCallbacks(timeoutRunnable)
+                                if (!call.fail()) return
                                 android.util.Log.e("YellPay", "paymentForQR() - getMainCreditCard FAILED - Code: $errorCode, Message: $errorMessage")
                                 resolveError(promise, "MAIN_CARD_ERROR", "Get main card failed ($errorCode): $errorMessage")
                             }
@@ -896,10 +1269,15 @@ class YellPayModule(reactContext: ReactApplicationContext) : ReactContextBaseJav
             }
 
             android.util.Log.d("YellPay", "Starting card selection - UserId: $userId")
+            // The selection UI can change the main card even if the flow is abandoned
+            invalidateMainCard()
 
             // Using RouteCode SDK signature: callCardSelect(String payUserId, Activity activity, EnvironmentMode environmentMode, ResponseCardSelectCallback callback)
             // The RouteCode SDK will show a card selection UI screen
-            withTimeout(promise, 20_000, "CARD_SELECT_TIMEOUT", "Card select timed out") { completed, timeoutRunnable ->
+            withTimeout("cardSelect", promise, 20_000, "CARD_SELECT_TIMEOUT", "Card select timed out", onTimeout = { tearDownFlow("cardSelect") }) { call ->
+                trackFlow("cardSelect", call, activity) {
+                    promise.reject("FLOW_CANCELLED", "cardSelect was cancelled")
+                }
                 routePay.callCardSelect(
                     userId,
                     activity,
@@ -907,8 +1285,8 @@ class YellPayModule(reactContext: ReactApplicationContext) : ReactContextBaseJav
                     object : RoutePay.ResponseCardSelectCallback {
                         override fun success(status: Int) {
                             try {
-                                if (!completed.compareAndSet(false, true)) return
-                                mainHandler.removeCallbacks(timeoutRunnable)
+                                if (!call.complete()) return
+                                finishFlow("cardSelect", call)
                                 val response = WritableNativeMap()
                                 response.putInt("status", status)
                                 response.putString("message", "Card selection completed successfully")
@@ -919,8 +1297,8 @@ class YellPayModule(reactContext: ReactApplicationContext) : ReactContextBaseJav
                         }
 
                         override fun failed(errorCode: Int, errorMessage: String) {
-                            if (!completed.compareAndSet(false, true)) return
-                            mainHandler.removeCallbacks(timeoutRunnable)
+                            if (!claimFailure(call, errorMessage)) return
+                            finishFlow("cardSelect", call)
                             promise.reject("CARD_SELECT_ERROR", "Card selection failed (Code: $errorCode): $errorMessage")
                         }
                     }
@@ -933,8 +1311,17 @@ class YellPayModule(reactContext: ReactApplicationContext) : ReactContextBaseJav
     }
 
     @ReactMethod
-    fun getMainCreditCard(promise: Promise) {
+    fun getMainCreditCard(payUserId: String, promise: Promise) {
         try {
+            // Main card lookup is usually followed by a payment; open the backend
+            // connections now so the payment call does not pay for a fresh handshake.
+            YellPayConnectionPool.warmUp(currentEnvironmentName())
+
+            freshMainCard(payUserId)?.let { card ->
+                resolvePromiseSafe(promise, card.toWritableMap())
+                return
+            }
+
             val activity = getSafeCurrentActivity()
             if (activity == null) {
                 rejectWithActivityError(promise, "get main credit card")
@@ -943,28 +1330,23 @@ class YellPayModule(reactContext: ReactApplicationContext) : ReactContextBaseJav
 
             // Using the correct signature: callGetMainCreditCard(Activity activity, ResponseGetMainCreditCardCallback callback)
             // Callback signature: success(String, int, String, String)
-            withTimeout(promise, 20_000, "MAIN_CARD_TIMEOUT", "Get main credit card timed out") { completed, timeoutRunnable ->
+            withTimeout("getMainCreditCard", promise, 20_000, "MAIN_CARD_TIMEOUT", "Get main credit card timed out") { call ->
                 routePay.callGetMainCreditCard(
                     activity,
                     object : RoutePay.ResponseGetMainCreditCardCallback {
                         override fun success(param1: String, param2: Int, param3: String, param4: String) {
                             try {
-                                if (!completed.compareAndSet(false, true)) return
-                                mainHandler.removeCallbacks(timeoutRunnable)
-                                val response = WritableNativeMap()
-                                response.putString("uuid", param1 ?: "")
-                                response.putInt("userNo", param2)
-                                response.putString("creditCardNo", param3 ?: "")
-                                response.putString("creditCardExp", param4 ?: "")
-                                promise.resolve(response)
+                                if (!call.complete()) return
+                                val card = MainCard(payUserId, param1 ?: "", param2, param3 ?: "", param4 ?: "")
+                                if (payUserId.isNotBlank()) cachedMainCard = card
+                                promise.resolve(card.toWritableMap())
                             } catch (e: Exception) {
                                 promise.reject("MAIN_CARD_CALLBACK_ERROR", "Error processing main credit card: ${e.message}", e)
                             }
                         }
 
                         override fun failed(errorCode: Int, errorMessage: String) {
-                            if (!completed.compareAndSet(false, true)) return
-                            mainHandler.removeCallbacks(timeoutRunnable)
+                            if (!call.fail()) return
                             promise.reject("MAIN_CARD_ERROR", "Error $errorCode: $errorMessage")
                         }
                     }
@@ -976,7 +1358,8 @@ class YellPayModule(reactContext: ReactApplicationContext) : ReactContextBaseJav
     }
 
     @ReactMethod
-    fun getUserInfo(userId: String, promise: Promise) {
+    fun getUserInfo(userId: String, caller: Promise) {
+        val promise = singleFlight("getUserInfo|$userId", caller) ?: return
         try {
             val activity = getSafeCurrentActivity()
             if (activity == null) {
@@ -989,54 +1372,55 @@ class YellPayModule(reactContext: ReactApplicationContext) : ReactContextBaseJav
                 return
             }
 
-            runOnMainThread {
-                try {
+            runForOperation("getUserInfo") {
+                withTimeout("getUserInfo", promise, 20_000, "USER_INFO_TIMEOUT", "Get user info timed out") { call ->
                     routePay.callGetUserInfo(
                         userId,
                         activity,
                         currentEnvironmentMode,
                         object : RoutePay.ResponseGetUserInfoCallback {
                             override fun success(userCertificates: Array<com.platfield.unidsdk.routecode.model.UserCertificateInfo>) {
-                                try {
-                                    android.util.Log.d("YellPay", "getUserInfo success - ${userCertificates.size} certificates")
-                                    val resultArray = WritableNativeArray()
-                                    userCertificates.forEach { cert ->
-                                        val certMap = WritableNativeMap()
+                                decodeOnExecutor("getUserInfo") {
+                                    try {
+                                        if (!call.complete()) return@decodeOnExecutor
+                                        android.util.Log.d("YellPay", "getUserInfo success - ${userCertificates.size} certificates")
+                                        val resultArray = WritableNativeArray()
+                                        userCertificates.forEach { cert ->
+                                            val certMap = WritableNativeMap()
                                         
-                                        // Extract certificate properties using reflection
-                                        try {
-                                            // Try to get the actual fields from the certificate object
-                                            val klass = cert.javaClass
-                                                        certMap.putString("certificateType", extractField(cert, "certificateType") ?: "")
-                                            val statusValue = extractField(cert, "status")?.toIntOrNull() ?: 0
-                                            certMap.putInt("status", statusValue)
-                                            certMap.putString("additionalInfo", extractField(cert, "additionalInfo") ?: "")
-                                            android.util.Log.d("YellPay", "Certificate extracted: $certMap")
-                                        } catch (e: Exception) {
-                                            android.util.Log.e("YellPay", "Failed to extract certificate fields: ${e.message}")
-                                            // Fallback: return toString representation
-                                            certMap.putString("certificateInfo", cert.toString())
-                                        }
+                                            // Extract certificate properties using reflection
+                                            try {
+                                                // Try to get the actual fields from the certificate object
+                                                val klass = cert.javaClass
+                                                            certMap.putString("certificateType", extractField(cert, "certificateType") ?: "")
+                                                val statusValue = extractField(cert, "status")?.toIntOrNull() ?: 0
+                                                certMap.putInt("status", statusValue)
+                                                certMap.putString("additionalInfo", extractField(cert, "additionalInfo") ?: "")
+                                                android.util.Log.d("YellPay", "Certificate extracted: $certMap")
+                                            } catch (e: Exception) {
+                                                android.util.Log.e("YellPay", "Failed to extract certificate fields: ${e.message}")
+                                                // Fallback: return toString representation
+                                                certMap.putString("certificateInfo", cert.toString())
+                                            }
                                         
-                                        resultArray.pushMap(certMap)
+                                            resultArray.pushMap(certMap)
+                                        }
+                                        android.util.Log.d("YellPay", "getUserInfo resolving with ${resultArray.size()} items")
+                                        promise.resolve(resultArray)
+                                    } catch (e: Exception) {
+                                        android.util.Log.e("YellPay", "getUserInfo callback error: ${e.message}", e)
+                                        promise.reject("USER_INFO_ERROR", "Error processing certificates: ${e.message}", e)
                                     }
-                                    android.util.Log.d("YellPay", "getUserInfo resolving with ${resultArray.size()} items")
-                                    promise.resolve(resultArray)
-                                } catch (e: Exception) {
-                                    android.util.Log.e("YellPay", "getUserInfo callback error: ${e.message}", e)
-                                    promise.reject("USER_INFO_ERROR", "Error processing certificates: ${e.message}", e)
                                 }
                             }
 
                             override fun failed(errorCode: Int, errorMessage: String) {
+                                if (!call.fail()) return
                                 android.util.Log.e("YellPay", "getUserInfo failed - $errorCode: $errorMessage")
                                 promise.reject("USER_INFO_ERROR", "Get user info failed: $errorMessage")
                             }
                         }
                     )
-                } catch (e: Exception) {
-                    android.util.Log.e("YellPay", "getUserInfo SDK call error: ${e.message}", e)
-                    promise.reject("USER_INFO_ERROR", "SDK call failed: ${e.message}", e)
                 }
             }
         } catch (e: Exception) {
@@ -1059,7 +1443,8 @@ class YellPayModule(reactContext: ReactApplicationContext) : ReactContextBaseJav
     }
 
     @ReactMethod
-    fun viewCertificate(userId: String, promise: Promise) {
+    fun viewCertificate(userId: String, caller: Promise) {
+        val promise = singleFlight("viewCertificate|$userId", caller) ?: return
         try {
             val activity = getSafeCurrentActivity()
             if (activity == null) {
@@ -1072,7 +1457,7 @@ class YellPayModule(reactContext: ReactApplicationContext) : ReactContextBaseJav
 
             // Using the correct signature: callViewCertificate(String userId, Activity activity, EnvironmentMode mode, ResponseViewCertificateCallback callback)
             // Callback signature: success() - no parameters
-            withTimeout(promise, 20_000, "CERTIFICATE_TIMEOUT", "View certificate timed out") { completed, timeoutRunnable ->
+            withTimeout("viewCertificate", promise, 20_000, "CERTIFICATE_TIMEOUT", "View certificate timed out") { call ->
                 routePay.callViewCertificate(
                     userId,
                     activity,
@@ -1080,8 +1465,7 @@ class YellPayModule(reactContext: ReactApplicationContext) : ReactContextBaseJav
                     object : RoutePay.ResponseViewCertificateCallback {
                         override fun success() {
                             try {
-                                if (!completed.compareAndSet(false, true)) return
-                                mainHandler.removeCallbacks(timeoutRunnable)
+                                if (!call.complete()) return
                                 promise.resolve("Certificate view completed successfully")
                             } catch (e: Exception) {
                                 promise.reject("CERTIFICATE_CALLBACK_ERROR", "Error processing certificate: ${e.message}", e)
@@ -1089,8 +1473,7 @@ class YellPayModule(reactContext: ReactApplicationContext) : ReactContextBaseJav
                         }
 
                         override fun failed(errorCode: Int, errorMessage: String) {
-                            if (!completed.compareAndSet(false, true)) return
-                            mainHandler.removeCallbacks(timeoutRunnable)
+                            if (!call.fail()) return
                             promise.reject("CERTIFICATE_ERROR", "Error $errorCode: $errorMessage")
                         }
                     }
@@ -1102,7 +1485,8 @@ class YellPayModule(reactContext: ReactApplicationContext) : ReactContextBaseJav
     }
 
     @ReactMethod
-    fun getNotification(payUserId: String, lastUpdate: Int, promise: Promise) {
+    fun getNotification(payUserId: String, lastUpdate: Int, caller: Promise) {
+        val promise = singleFlight("getNotification|$payUserId|$lastUpdate", caller) ?: return
         try {
             val activity = getSafeCurrentActivity()
             if (activity == null) {
@@ -1112,48 +1496,153 @@ class YellPayModule(reactContext: ReactApplicationContext) : ReactContextBaseJav
 
             // Using the correct signature: callGetNotification(String payUserId, int lastUpdate, Activity activity, EnvironmentMode mode, ResponseGetNotificationCallback callback)
             // Callback signature: success(int, UserNotification[])
-            withTimeout(promise, 20_000, "NOTIFICATION_TIMEOUT", "Get notification timed out") { completed, timeoutRunnable ->
-                routePay.callGetNotification(
-                    payUserId,
-                    lastUpdate,
-                    activity,
-                    currentEnvironmentMode,
-                    object : RoutePay.ResponseGetNotificationCallback {
-                        override fun success(totalCount: Int, notifications: Array<com.platfield.unidsdk.routecode.model.UserNotification>) {
-                            try {
-                                if (!completed.compareAndSet(false, true)) return
-                                mainHandler.removeCallbacks(timeoutRunnable)
-                                val response = WritableNativeMap()
-                                response.putInt("totalCount", totalCount)
+            runForOperation("getNotification") {
+                withTimeout("getNotification", promise, 20_000, "NOTIFICATION_TIMEOUT", "Get notification timed out") { call ->
+                    routePay.callGetNotification(
+                        payUserId,
+                        lastUpdate,
+                        activity,
+                        currentEnvironmentMode,
+                        object : RoutePay.ResponseGetNotificationCallback {
+                            override fun success(totalCount: Int, notifications: Array<com.platfield.unidsdk.routecode.model.UserNotification>) {
+                                decodeOnExecutor("getNotification") {
+                                    try {
+                                        if (!call.complete()) return@decodeOnExecutor
+                                        val response = WritableNativeMap()
+                                        response.putInt("totalCount", totalCount)
+                                        // The SDK reports the lastUpdateNotification watermark in this slot
+                                        response.putInt("lastUpdate", totalCount)
                                 
-                                val notificationsArray = WritableNativeArray()
-                                notifications.forEach { notification ->
-                                    val notificationMap = WritableNativeMap()
-                                    notificationMap.putString("notification", notification.toString())
-                                    notificationsArray.pushMap(notificationMap)
+                                        val notificationsArray = WritableNativeArray()
+                                        notifications.forEach { notification ->
+                                            val notificationMap = WritableNativeMap()
+                                            notificationMap.putString("notification", notification.toString())
+                                            notificationsArray.pushMap(notificationMap)
+                                        }
+                                        response.putArray("notifications", notificationsArray)
+                                        promise.resolve(response)
+                                    } catch (e: Exception) {
+                                        promise.reject("NOTIFICATION_CALLBACK_ERROR", "Error processing notification: ${e.message}", e)
+                                    }
                                 }
-                                response.putArray("notifications", notificationsArray)
-                                promise.resolve(response)
-                            } catch (e: Exception) {
-                                promise.reject("NOTIFICATION_CALLBACK_ERROR", "Error processing notification: ${e.message}", e)
                             }
-                        }
 
-                        override fun failed(errorCode: Int, errorMessage: String) {
-                            if (!completed.compareAndSet(false, true)) return
-                            mainHandler.removeCallbacks(timeoutRunnable)
-                            promise.reject("NOTIFICATION_ERROR", "Error $errorCode: $errorMessage")
+                            override fun failed(errorCode: Int, errorMessage: String) {
+                                if (!call.fail()) return
+                                promise.reject("NOTIFICATION_ERROR", "Error $errorCode: $errorMessage")
+                            }
                         }
+                    )
+                }
+            }
+        } catch (e: Exception) {
+            promise.reject("NOTIFICATION_ERROR", e.message ?: "Unknown error in getNotification", e)
+        }
+    }
+
+    private val notificationStore by lazy { YellPayNotificationStore(reactApplicationContext) }
+
+    /**
+     * Fetches only notifications newer than the stored watermark and appends them to the
+     * local store. Resolves counts only; use getStoredNotifications to page.
+     */
+    @ReactMethod
+    fun syncNotifications(payUserId: String, promise: Promise) {
+        if (payUserId.isBlank()) {
+            promise.reject("SYNC_NOTIFICATIONS_ERROR", "userId cannot be empty")
+            return
+        }
+        val watermark = notificationStore.watermark(payUserId)
+
+        getNotification(payUserId, watermark, PromiseImpl(
+            { args ->
+                try {
+                    val response = args.getOrNull(0) as? ReadableMap
+                    val items = response?.getArray("notifications")
+                    val notifications = (0 until (items?.size() ?: 0)).mapNotNull { i ->
+                        items?.getMap(i)?.getString("notification")?.let { mapOf("notification" to it) }
                     }
+                    val lastUpdate = if (response?.hasKey("lastUpdate") == true) response.getInt("lastUpdate") else 0
+                    val (added, total) = notificationStore.append(payUserId, notifications, lastUpdate, "notification")
+                    android.util.Log.d("YellPay", "syncNotifications() - $added new, $total stored, watermark $watermark -> $lastUpdate")
+
+                    val result = WritableNativeMap()
+                    result.putInt("added", added)
+                    result.putInt("total", total)
+                    result.putInt("lastUpdate", maxOf(watermark, lastUpdate))
+                    resolvePromiseSafe(promise, result)
+                } catch (e: Exception) {
+                    promise.reject("SYNC_NOTIFICATIONS_ERROR", e.message ?: "Failed to store notifications", e)
+                }
+            },
+            { args ->
+                val error = args.getOrNull(0) as? ReadableMap
+                promise.reject(
+                    error?.getString("code") ?: "SYNC_NOTIFICATIONS_ERROR",
+                    error?.getString("message") ?: "Failed to sync notifications"
+                )
+            }
+        ))
+    }
+
+    @ReactMethod
+    fun getStoredNotifications(payUserId: String, offset: Int, limit: Int, promise: Promise) {
+        try {
+            val (notifications, total, lastUpdate) = notificationStore.page(payUserId, offset, limit)
+            val items = WritableNativeArray()
+            notifications.forEach { entry ->
+                val map = WritableNativeMap()
+                entry.forEach { (key, value) -> map.putString(key, value) }
+                items.pushMap(map)
+            }
+            val result = WritableNativeMap()
+            result.putInt("total", total)
+            result.putInt("lastUpdate", lastUpdate)
+            result.putArray("notifications", items)
+            resolvePromiseSafe(promise, result)
+        } catch (e: Exception) {
+            promise.reject("STORED_NOTIFICATIONS_ERROR", e.message ?: "Failed to read stored notifications", e)
+        }
+    }
+
+    /** Cursor-paged, filtered read of the local store; see YellPayNotificationStore.query */
+    @ReactMethod
+    fun queryStoredNotifications(payUserId: String, query: ReadableMap, promise: Promise) {
+        try {
+            fun text(key: String): String? =
+                if (query.hasKey(key) && !query.isNull(key)) query.getString(key)?.takeIf { it.isNotEmpty() } else null
+            fun number(key: String): Int? =
+                if (query.hasKey(key) && !query.isNull(key)) query.getDouble(key).toInt() else null
+
+            val (notifications, nextCursor, total) = notificationStore.query(
+                payUserId,
+                YellPayNotificationStore.Query(
+                    cursor = number("cursor"),
+                    limit = maxOf(1, number("limit") ?: 20),
+                    search = text("search"),
+                    since = text("since"),
+                    until = text("until")
                 )
+            )
+            val items = WritableNativeArray()
+            notifications.forEach { entry ->
+                val map = WritableNativeMap()
+                entry.forEach { (key, value) -> map.putString(key, value) }
+                items.pushMap(map)
             }
+            val result = WritableNativeMap()
+            result.putInt("total", total)
+            if (nextCursor != null) result.putInt("nextCursor", nextCursor) else result.putNull("nextCursor")
+            result.putArray("notifications", items)
+            resolvePromiseSafe(promise, result)
         } catch (e: Exception) {
-            promise.reject("NOTIFICATION_ERROR", e.message ?: "Unknown error in getNotification", e)
+            promise.reject("STORED_NOTIFICATIONS_ERROR", e.message ?: "Failed to query stored notifications", e)
         }
     }
 
     @ReactMethod
-    fun getInformation(userId: String, infoType: Int, promise: Promise) {
+    fun getInformation(userId: String, infoType: Int, caller: Promise) {
+        val promise = singleFlight("getInformation|$userId|$infoType", caller) ?: return
         try {
             val activity = getSafeCurrentActivity()
             if (activity == null) {
@@ -1163,48 +1652,131 @@ class YellPayModule(reactContext: ReactApplicationContext) : ReactContextBaseJav
 
             // Using the correct signature: callGetInformation(String userId, int infoType, Activity activity, EnvironmentMode mode, ResponseGetInformationCallback callback)
             // Callback signature: success(int, UserNotification[], JSONObject)
-            withTimeout(promise, 20_000, "INFORMATION_TIMEOUT", "Get information timed out") { completed, timeoutRunnable ->
-                routePay.callGetInformation(
-                    userId,
-                    infoType,
-                    activity,
-                    currentEnvironmentMode,
-                    object : RoutePay.ResponseGetInformationCallback {
-                        override fun success(totalCount: Int, notifications: Array<com.platfield.unidsdk.routecode.model.UserNotification>, jsonObject: JSONObject) {
-                            try {
-                                if (!completed.compareAndSet(false, true)) return
-                                mainHandler.removeCallbacks(timeoutRunnable)
-                                val response = WritableNativeMap()
-                                response.putInt("totalCount", totalCount)
+            runForOperation("getInformation") {
+                withTimeout("getInformation", promise, 20_000, "INFORMATION_TIMEOUT", "Get information timed out") { call ->
+                    routePay.callGetInformation(
+                        userId,
+                        infoType,
+                        activity,
+                        currentEnvironmentMode,
+                        object : RoutePay.ResponseGetInformationCallback {
+                            override fun success(totalCount: Int, notifications: Array<com.platfield.unidsdk.routecode.model.UserNotification>, jsonObject: JSONObject) {
+                                decodeOnExecutor("getInformation") {
+                                    try {
+                                        if (!call.complete()) return@decodeOnExecutor
+                                        val response = WritableNativeMap()
+                                        response.putInt("totalCount", totalCount)
                                 
-                                val notificationsArray = WritableNativeArray()
-                                notifications.forEach { notification ->
-                                    val notificationMap = WritableNativeMap()
-                                    notificationMap.putString("notification", notification.toString())
-                                    notificationsArray.pushMap(notificationMap)
-                                }
-                                response.putArray("notifications", notificationsArray)
-                                response.putString("jsonData", jsonObject?.toString() ?: "{}")
+                                        val notificationsArray = WritableNativeArray()
+                                        notifications.forEach { notification ->
+                                            val notificationMap = WritableNativeMap()
+                                            notificationMap.putString("notification", notification.toString())
+                                            notificationsArray.pushMap(notificationMap)
+                                        }
+                                        response.putArray("notifications", notificationsArray)
+                                        response.putString("jsonData", jsonObject?.toString() ?: "{}")
                                 
-                                promise.resolve(response)
-                            } catch (e: Exception) {
-                                promise.reject("INFORMATION_CALLBACK_ERROR", "Error processing information: ${e.message}", e)
+                                        promise.resolve(response)
+                                    } catch (e: Exception) {
+                                        promise.reject("INFORMATION_CALLBACK_ERROR", "Error processing information: ${e.message}", e)
+                                    }
+                                }
                             }
-                        }
 
-                        override fun failed(errorCode: Int, errorMessage: String) {
-                            if (!completed.compareAndSet(false, true)) return
-                            mainHandler.removeCallbacks(timeoutRunnable)
-                            promise.reject("INFORMATION_ERROR", "Error $errorCode: $errorMessage")
+                            override fun failed(errorCode: Int, errorMessage: String) {
+                                if (!call.fail()) return
+                                promise.reject("INFORMATION_ERROR", "Error $errorCode: $errorMessage")
+                            }
                         }
-                    }
-                )
+                    )
+                }
             }
         } catch (e: Exception) {
             promise.reject("INFORMATION_ERROR", e.message ?: "Unknown error in getInformation", e)
         }
     }
 
+    // ===== BATCH METHODS =====
+
+    /**
+     * Runs several read-only SDK calls concurrently and resolves once with one entry per
+     * operation, in request order: { method, ok, result } or { method, ok: false, code, message }.
+     * A failing entry never rejects the whole batch.
+     */
+    @ReactMethod
+    fun batch(operations: ReadableArray, promise: Promise) {
+        val count = operations.size()
+        if (count == 0) {
+            resolvePromiseSafe(promise, WritableNativeArray())
+            return
+        }
+
+        val results = arrayOfNulls<WritableMap>(count)
+        var remaining = count
+        val lock = Any()
+
+        // Each entry completes exactly once even if the SDK calls back late after a timeout
+        fun complete(index: Int, entry: WritableMap) {
+            val done = synchronized(lock) {
+                if (results[index] != null) return
+                results[index] = entry
+                remaining -= 1
+                remaining == 0
+            }
+            if (done) {
+                val response = WritableNativeArray()
+                results.forEach { response.pushMap(it) }
+                resolvePromiseSafe(promise, response)
+            }
+        }
+
+        for (index in 0 until count) {
+            val operation = operations.getMap(index)
+            val method = operation?.getString("method") ?: ""
+            val userId = if (operation?.hasKey("userId") == true) operation.getString("userId") ?: "" else ""
+            val lastUpdate = if (operation?.hasKey("lastUpdate") == true) operation.getInt("lastUpdate") else 0
+
+            val entryPromise = PromiseImpl(
+                { args ->
+                    val entry = WritableNativeMap()
+                    entry.putString("method", method)
+                    entry.putBoolean("ok", true)
+                    putBatchValue(entry, "result", args.getOrNull(0))
+                    complete(index, entry)
+                },
+                { args ->
+                    val error = args.getOrNull(0) as? ReadableMap
+                    val entry = WritableNativeMap()
+                    entry.putString("method", method)
+                    entry.putBoolean("ok", false)
+                    entry.putString("code", error?.getString("code") ?: "BATCH_ERROR")
+                    entry.putString("message", error?.getString("message") ?: "")
+                    complete(index, entry)
+                }
+            )
+
+            when (method) {
+                "getUserInfo" -> getUserInfo(userId, entryPromise)
+                "getInformation" -> getInformation(userId, lastUpdate, entryPromise)
+                "getNotification" -> getNotification(userId, lastUpdate, entryPromise)
+                else -> entryPromise.reject("BATCH_UNSUPPORTED_METHOD", "Method '$method' cannot be batched")
+            }
+        }
+    }
+
+    private fun putBatchValue(map: WritableMap, key: String, value: Any?) {
+        when (value) {
+            null -> map.putNull(key)
+            is String -> map.putString(key, value)
+            is Boolean -> map.putBoolean(key, value)
+            is Int -> map.putInt(key, value)
+            is Number -> map.putDouble(key, value.toDouble())
+            is ReadableMap -> map.putMap(key, value)
+            is ReadableArray -> map.putArray(key, value)
+            else -> map.putString(key, value.toString())
+        }
+    }
+
     // ===== HELPER METHODS =====
 
     private fun getSafeCurrentActivity(): Activity? {
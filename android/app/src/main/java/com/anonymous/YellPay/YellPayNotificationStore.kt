@@ -0,0 +1,142 @@
+package com.anonymous.YellPay
+
+import android.content.Context
+import org.json.JSONArray
+import org.json.JSONObject
+import java.io.File
+
+/**
+ * Append-only, per-user notification store persisted in the app's files directory.
+ * Sync only asks the SDK for entries newer than the stored lastUpdate watermark;
+ * screens page through the local copy instead of re-bridging the whole history.
+ */
+class YellPayNotificationStore(context: Context) {
+
+    class Snapshot(var lastUpdate: Int = 0, val notifications: MutableList<Map<String, String>> = mutableListOf())
+
+    /**
+     * Filters for [query]. Dates compare as strings against each entry's `date`, so pass
+     * them in the SDK's own (year-first) format; entries without a date never match them.
+     */
+    class Query(
+        val cursor: Int? = null,
+        val limit: Int = 20,
+        val search: String? = null,
+        val since: String? = null,
+        val until: String? = null
+    )
+
+    private val directory = File(context.filesDir, "yellpay/notifications")
+    private val cache = mutableMapOf<String, Snapshot>()
+    // Lower-cased text of each stored entry, parallel to Snapshot.notifications; built on first query
+    private val searchIndex = mutableMapOf<String, MutableList<String>>()
+
+    private fun fileFor(userId: String): File {
+        if (!directory.exists()) directory.mkdirs()
+        return File(directory, "$userId.json")
+    }
+
+    @Synchronized
+    private fun load(userId: String): Snapshot {
+        cache[userId]?.let { return it }
+        val snapshot = Snapshot()
+        try {
+            val file = fileFor(userId)
+            if (file.exists()) {
+                val json = JSONObject(file.readText())
+                snapshot.lastUpdate = json.optInt("lastUpdate", 0)
+                val items = json.optJSONArray("notifications") ?: JSONArray()
+                for (i in 0 until items.length()) {
+                    val item = items.optJSONObject(i) ?: continue
+                    snapshot.notifications.add(item.keys().asSequence().associateWith { item.optString(it) })
+                }
+            }
+        } catch (e: Exception) {
+            android.util.Log.e("YellPay", "Notification store read failed: ${e.message}", e)
+        }
+        cache[userId] = snapshot
+        return snapshot
+    }
+
+    @Synchronized
+    fun watermark(userId: String): Int = load(userId).lastUpdate
+
+    /**
+     * Appends entries not seen before (keyed by [idKey]) and advances the watermark.
+     * Returns the number of new entries and the new total.
+     */
+    @Synchronized
+    fun append(userId: String, notifications: List<Map<String, String>>, lastUpdate: Int, idKey: String): Pair<Int, Int> {
+        val snapshot = load(userId)
+        val known = snapshot.notifications.mapNotNullTo(HashSet()) { it[idKey] }
+        var added = 0
+        notifications.forEach { entry ->
+            val id = entry[idKey].orEmpty()
+            if (id.isNotEmpty() && !known.add(id)) return@forEach
+            snapshot.notifications.add(entry)
+            added++
+        }
+        snapshot.lastUpdate = maxOf(snapshot.lastUpdate, lastUpdate)
+        searchIndex[userId]?.addAll(snapshot.notifications.takeLast(added).map(::searchText))
+
+        try {
+            val items = JSONArray()
+            snapshot.notifications.forEach { items.put(JSONObject(it)) }
+            val json = JSONObject()
+            json.put("lastUpdate", snapshot.lastUpdate)
+            json.put("notifications", items)
+            val file = fileFor(userId)
+            val tmp = File(file.parentFile, "${file.name}.tmp")
+            tmp.writeText(json.toString())
+            tmp.renameTo(file)
+        } catch (e: Exception) {
+            android.util.Log.e("YellPay", "Notification store write failed: ${e.message}", e)
+        }
+        return added to snapshot.notifications.size
+    }
+
+    /** Newest-first page of the stored notifications */
+    @Synchronized
+    fun page(userId: String, offset: Int, limit: Int): Triple<List<Map<String, String>>, Int, Int> {
+        val snapshot = load(userId)
+        val total = snapshot.notifications.size
+        val start = maxOf(0, offset)
+        if (start >= total || limit <= 0) return Triple(emptyList(), total, snapshot.lastUpdate)
+        val end = minOf(total, start + limit)
+        val page = snapshot.notifications.subList(total - end, total - start).reversed()
+        return Triple(page, total, snapshot.lastUpdate)
+    }
+
+    private fun searchText(entry: Map<String, String>): String = entry.values.joinToString("\n").lowercase()
+
+    /**
+     * Newest-first page that starts just below [Query.cursor] (a position in the append-only
+     * list), so pages stay stable while syncs append. The returned cursor is null at the end.
+     */
+    @Synchronized
+    fun query(userId: String, query: Query): Triple<List<Map<String, String>>, Int?, Int> {
+        val snapshot = load(userId)
+        val total = snapshot.notifications.size
+        val needle = query.search?.trim()?.lowercase().orEmpty()
+        val index = if (needle.isEmpty()) emptyList() else {
+            searchIndex.getOrPut(userId) { snapshot.notifications.mapTo(mutableListOf(), ::searchText) }
+        }
+
+        val results = mutableListOf<Map<String, String>>()
+        var position = (query.cursor ?: total).coerceIn(0, total)
+        while (position > 0 && results.size < query.limit) {
+            position--
+            val entry = snapshot.notifications[position]
+            if (needle.isNotEmpty() && !index[position].contains(needle)) continue
+            if (query.since != null || query.until != null) {
+                val date = entry["date"]
+                if (date.isNullOrEmpty()) continue
+                if (query.since != null && date < query.since) continue
+                // until is inclusive: a bare day also matches times on that day
+                if (query.until != null && date > query.until && !date.startsWith(query.until)) continue
+            }
+            results.add(entry)
+        }
+        return Triple(results, if (position > 0) position else null, total)
+    }
+}
@@ -0,0 +1,87 @@
+package com.anonymous.YellPay
+
+import org.junit.Assert.assertFalse
+import org.junit.Assert.assertTrue
+import org.junit.Before
+import org.junit.Test
+
+class YellPayCircuitBreakerTest {
+
+    private var now = 0L
+
+    @Before
+    fun setUp() {
+        YellPayCircuitBreaker.clock = { now }
+        YellPayCircuitBreaker.configure(
+            YellPayCircuitBreaker.Spec(
+                windowSize = 4,
+                minimumCalls = 2,
+                failureRateThreshold = 0.5,
+                baseCooldownMs = 1_000,
+                maxCooldownMs = 8_000,
+                halfOpenProbes = 1
+            )
+        )
+        YellPayCircuitBreaker.reset()
+    }
+
+    private fun trip(key: String) {
+        assertTrue(YellPayCircuitBreaker.allow(key))
+        YellPayCircuitBreaker.record(key, failed = true)
+        assertTrue(YellPayCircuitBreaker.allow(key))
+        YellPayCircuitBreaker.record(key, failed = true)
+    }
+
+    @Test
+    fun opensOnceFailureRateCrossesThreshold() {
+        trip("getUserInfo")
+        assertFalse(YellPayCircuitBreaker.allow("getUserInfo"))
+        assertTrue(YellPayCircuitBreaker.allow("getHistory"))
+    }
+
+    @Test
+    fun ignoresOperationsItDoesNotGate() {
+        repeat(4) { YellPayCircuitBreaker.record("makePayment", failed = true) }
+        assertTrue(YellPayCircuitBreaker.allow("makePayment"))
+    }
+
+    @Test
+    fun halfOpenProbeSuccessCloses() {
+        trip("getUserInfo")
+        now += 999
+        assertFalse(YellPayCircuitBreaker.allow("getUserInfo"))
+
+        now += 1
+        assertTrue(YellPayCircuitBreaker.allow("getUserInfo"))
+        // Only one probe at a time
+        assertFalse(YellPayCircuitBreaker.allow("getUserInfo"))
+
+        YellPayCircuitBreaker.record("getUserInfo", failed = false)
+        assertTrue(YellPayCircuitBreaker.allow("getUserInfo"))
+        assertTrue(YellPayCircuitBreaker.allow("getUserInfo"))
+    }
+
+    @Test
+    fun halfOpenProbeFailureReopensWithDoubledCooldown() {
+        trip("getUserInfo")
+        now += 1_000
+        assertTrue(YellPayCircuitBreaker.allow("getUserInfo"))
+        YellPayCircuitBreaker.record("getUserInfo", failed = true)
+
+        now += 1_999
+        assertFalse(YellPayCircuitBreaker.allow("getUserInfo"))
+        now += 1
+        assertTrue(YellPayCircuitBreaker.allow("getUserInfo"))
+    }
+
+    @Test
+    fun releaseFreesCancelledProbeSlot() {
+        trip("getUserInfo")
+        now += 1_000
+        assertTrue(YellPayCircuitBreaker.allow("getUserInfo"))
+        assertFalse(YellPayCircuitBreaker.allow("getUserInfo"))
+
+        YellPayCircuitBreaker.release("getUserInfo")
+        assertTrue(YellPayCircuitBreaker.allow("getUserInfo"))
+    }
+}
@@ -0,0 +1,94 @@
+package com.anonymous.YellPay
+
+import org.junit.Assert.assertEquals
+import org.junit.Assert.assertFalse
+import org.junit.Assert.assertTrue
+import org.junit.Before
+import org.junit.Test
+import java.util.concurrent.CountDownLatch
+import java.util.concurrent.TimeUnit
+import java.util.concurrent.atomic.AtomicInteger
+
+class YellPayCompletionEngineTest {
+
+    companion object {
+        // The engine is a process-wide object, so its clock must never go backwards between tests
+        @Volatile
+        private var now = 0L
+    }
+
+    @Before
+    fun setUp() {
+        YellPayCompletionEngine.clock = { now }
+        YellPayCompletionEngine.postToMain = { it.run() }
+        YellPayCircuitBreaker.clock = { now }
+        YellPayCircuitBreaker.configure(
+            YellPayCircuitBreaker.Spec(windowSize = 1, minimumCalls = 1, failureRateThreshold = 1.0, baseCooldownMs = 1_000)
+        )
+        YellPayCircuitBreaker.reset()
+    }
+
+    @Test
+    fun callIsClaimedOnlyOnce() {
+        val call = YellPayCompletionEngine.begin("getUserInfo", 5_000) {}
+        assertTrue(call.complete())
+        assertFalse(call.fail())
+        assertFalse(call.cancel())
+        assertFalse(call.complete())
+        assertEquals(0, YellPayCompletionEngine.pendingCount)
+    }
+
+    @Test
+    fun failureCountsTowardsTheBreaker() {
+        val call = YellPayCompletionEngine.begin("getUserInfo", 5_000) {}
+        assertTrue(call.fail())
+        assertFalse(YellPayCircuitBreaker.allow("getUserInfo"))
+    }
+
+    @Test
+    fun cancelDoesNotCountAsFailure() {
+        val call = YellPayCompletionEngine.begin("getUserInfo", 5_000) {}
+        assertTrue(call.cancel())
+        assertTrue(YellPayCircuitBreaker.allow("getUserInfo"))
+    }
+
+    @Test
+    fun timeoutFiresOnceAndRefusesLateClaims() {
+        val fired = AtomicInteger()
+        val latch = CountDownLatch(1)
+        val call = YellPayCompletionEngine.begin("getUserInfo", 1_000) {
+            fired.incrementAndGet()
+            latch.countDown()
+        }
+
+        now += 750
+        YellPayCompletionEngine.advance()
+        assertEquals(0, fired.get())
+
+        now += 250
+        YellPayCompletionEngine.advance()
+        // The scheduler thread may have reached the deadline first
+        assertTrue(latch.await(1, TimeUnit.SECONDS))
+        YellPayCompletionEngine.advance()
+
+        assertEquals(1, fired.get())
+        assertFalse(call.complete())
+        assertEquals(0, YellPayCompletionEngine.pendingCount)
+        // A timeout is a failure for the breaker
+        assertFalse(YellPayCircuitBreaker.allow("getUserInfo"))
+    }
+
+    @Test
+    fun timeoutLeavesOtherCallsPending() {
+        val fired = AtomicInteger()
+        val short = YellPayCompletionEngine.begin("getHistory", 500) { fired.incrementAndGet() }
+        val long = YellPayCompletionEngine.begin("getHistory", 10_000) { fired.incrementAndGet() }
+
+        now += 500
+        YellPayCompletionEngine.advance()
+
+        assertFalse(short.complete())
+        assertTrue(long.complete())
+        assertEquals(0, YellPayCompletionEngine.pendingCount)
+    }
+}
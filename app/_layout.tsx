@@ -3,15 +3,19 @@ import { DefaultTheme, ThemeProvider } from '@react-navigation/native';
 import { useFonts } from 'expo-font';
 import { Stack, usePathname } from 'expo-router';
 import { StatusBar } from 'expo-status-bar';
-import { useMemo } from 'react';
-import { ActivityIndicator } from 'react-native';
+import { useEffect, useMemo } from 'react';
+import { ActivityIndicator, NativeModules } from 'react-native';
 import 'react-native-reanimated';
 import { Provider } from 'react-redux';
 import { PersistGate } from 'redux-persist/integration/react';
 import { BottomNavigation } from '../src/components/BottomNavigation';
 import Providers from '../src/components/Providers';
+import { CIRCUIT_BREAKER_SPEC } from '../src/constants/circuitBreaker';
 import { persistor, store } from '../src/redux/store';
 import { colors } from '../src/theme/colors';
+import type { YellPayModule } from '../src/types/YellPay';
+
+const { YellPay }: { YellPay: YellPayModule } = NativeModules;
 
 export default function RootLayout() {
   const [loaded] = useFonts({
@@ -30,6 +34,13 @@ export default function RootLayout() {
     'Roboto Medium': require('../assets/fonts/Roboto-Medium.ttf'),
   });
 
+  useEffect(() => {
+    // Same breaker thresholds on both platforms, before any screen calls the SDK
+    YellPay?.configureCircuitBreaker(CIRCUIT_BREAKER_SPEC).catch((error) => {
+      console.warn('Failed to configure YellPay circuit breaker:', error);
+    });
+  }, []);
+
   const pathname = usePathname();
   const showBottomNavigation = useMemo(() => {
     return ['/home', '/easy-login', '/announcements', '/settings'].includes(pathname);
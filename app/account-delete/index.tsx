@@ -16,7 +16,7 @@ import { Stack, useRouter } from 'expo-router';
 import { StatusBar } from 'expo-status-bar';
 import { ChevronLeft, InfoIcon, TriangleAlert } from 'lucide-react-native';
 import { useState } from 'react';
-import { Image, Platform, TouchableOpacity } from 'react-native';
+import { Image, NativeModules, Platform, TouchableOpacity } from 'react-native';
 import { useDispatch, useSelector } from 'react-redux';
 import { GradientButton } from '../../src/components/GradientButton';
 import { clearRegistration } from '../../src/redux/slice/auth/registrationSlice';
@@ -24,6 +24,10 @@ import { persistor } from '../../src/redux/store';
 import { useDeleteUserMutation } from '../../src/services/appApi';
 import { colors } from '../../src/theme/colors';
 import { textStyle } from '../../src/theme/text-style';
+import type { YellPayModule } from '../../src/types/YellPay';
+import { clearAuthSession } from '../../src/utils/authSession';
+
+const { YellPay }: { YellPay: YellPayModule } = NativeModules;
 
 const AccountDelete = () => {
     const router = useRouter();
@@ -31,6 +35,7 @@ const AccountDelete = () => {
     const [deleteUser, { isLoading }] = useDeleteUserMutation();
     const [showSuccessModal, setShowSuccessModal] = useState(false);
     const token = useSelector((state: any) => state.registration.token);
+    const userId = useSelector((state: any) => state.registration.userId);
 
     const handleDeleteAccount = async () => {
         try {
@@ -38,7 +43,7 @@ const AccountDelete = () => {
             if (result.status === 'success' && result.message === 'Successfully Deleted this user') {
                 // Clear redux storage completely
                 dispatch(clearRegistration());
-                await persistor.purge();
+                await Promise.all([persistor.purge(), clearAuthSession(userId), YellPay.clearMainCardCache().catch(() => false)]);
 
                 // Show success modal
                 setShowSuccessModal(true);
@@ -10,17 +10,81 @@ import {
 import { Stack, useRouter } from 'expo-router';
 import { StatusBar } from 'expo-status-bar';
 import { ChevronRight } from 'lucide-react-native';
-import { TouchableOpacity } from 'react-native';
+import { useCallback, useEffect, useRef, useState } from 'react';
+import { NativeModules, TouchableOpacity } from 'react-native';
+import { useAppSelector } from '../../src/redux/hooks';
+import { RootState } from '../../src/redux/store';
 import { colors } from '../../src/theme/colors';
 import { textStyle } from '../../src/theme/text-style';
+import type { StoredNotification, YellPayModule } from '../../src/types/YellPay';
+
+const { YellPay }: { YellPay: YellPayModule } = NativeModules;
+
+const PAGE_SIZE = 20;
 
 const Announcements = () => {
   const router = useRouter();
+  const { userId } = useAppSelector((state: RootState) => state.registration);
+  const [notifications, setNotifications] = useState<StoredNotification[]>([]);
+  const [isSyncing, setIsSyncing] = useState(false);
+  const cursorRef = useRef<number | null>(null);
+  const loadingRef = useRef(false);
+
+  // Pages come from the native store; only the first page is re-read after a sync.
+  // The cursor is a position in the append-only store, so entries added by a sync
+  // never shift later pages and show up twice.
+  const loadPage = useCallback(
+    async (cursor: number | null) => {
+      if (!userId || (cursor !== null && loadingRef.current)) return;
+      loadingRef.current = true;
+      try {
+        const page = await YellPay.queryStoredNotifications(userId, { cursor, limit: PAGE_SIZE });
+        cursorRef.current = page.nextCursor;
+        setNotifications((current) =>
+          cursor === null ? page.notifications : [...current, ...page.notifications],
+        );
+      } catch (error) {
+        console.error('❌ queryStoredNotifications error:', error);
+      } finally {
+        loadingRef.current = false;
+      }
+    },
+    [userId],
+  );
+
+  const loadMore = () => {
+    if (cursorRef.current !== null) {
+      loadPage(cursorRef.current);
+    }
+  };
+
+  useEffect(() => {
+    if (!userId) return;
+
+    // Show what is stored right away, then fetch only the delta since the last watermark
+    loadPage(null);
+    setIsSyncing(true);
+    YellPay.syncNotifications(userId)
+      .then((result) => {
+        if (result.added > 0) {
+          loadPage(null);
+        }
+      })
+      .catch((error) => console.error('❌ syncNotifications error:', error))
+      .finally(() => setIsSyncing(false));
+  }, [userId, loadPage]);
 
   return (
     <SafeAreaView style={{ flex: 1 }}>
       <ScrollView
         style={{ backgroundColor: colors.wt, flex: 1, paddingBottom: 100 }}
+        onScroll={({ nativeEvent }) => {
+          const { layoutMeasurement, contentOffset, contentSize } = nativeEvent;
+          if (layoutMeasurement.height + contentOffset.y >= contentSize.height - 80) {
+            loadMore();
+          }
+        }}
+        scrollEventThrottle={200}
       >
         <StatusBar style="dark" />
         <Stack.Screen
@@ -39,133 +103,45 @@ const Announcements = () => {
         />
         <VStack paddingHorizontal={16} paddingVertical={24} gap={24}>
           <VStack>
-            <TouchableOpacity
-              onPress={() => {
-                router.push('/announcement-detail/1');
-              }}
-            >
-              <HStack
-                justifyContent="space-between"
-                alignItems="center"
-                paddingHorizontal={1}
-              >
-                <VStack>
-                  <HStack alignItems="center" gap={12} mb={8} maxWidth={'80%'}>
-                    <Text sx={{ ...textStyle.R_16_R, color: colors.gr5 }}>
-                      2022.12.01
-                    </Text>
-                    <Text
-                      sx={{
-                        ...textStyle.H_W3_13,
-                        color: colors.rd,
-                        borderWidth: 1,
-                        borderColor: colors.rd,
-                        paddingHorizontal: 6,
-                        paddingVertical: 3,
-                        borderRadius: 20,
-                      }}
-                    >
-                      メンテナンス
-                    </Text>
-                  </HStack>
-                  <Text
-                    sx={{
-                      ...textStyle.H_W6_15,
-                      color: colors.gr1,
-                    }}
+            {notifications.map((notification, index) => (
+              <VStack key={notification.id || notification.notification || index}>
+                <TouchableOpacity
+                  onPress={() => {
+                    router.push(`/announcement-detail/${notification.id || index}`);
+                  }}
+                >
+                  <HStack
+                    justifyContent="space-between"
+                    alignItems="center"
+                    paddingHorizontal={1}
                   >
-                    システムメンテナンス終了のお知らせ
-                  </Text>
-                </VStack>
-                <Icon as={ChevronRight} color={colors.rd} size="lg" />
-              </HStack>
-            </TouchableOpacity>
-            <Divider my={16} />
-            <TouchableOpacity
-              onPress={() => {
-                router.push('/announcement-detail/2');
-              }}
-            >
-              <HStack
-                justifyContent="space-between"
-                alignItems="center"
-                paddingHorizontal={1}
-              >
-                <VStack>
-                  <HStack alignItems="center" gap={12} mb={8} maxWidth={'80%'}>
-                    <Text sx={{ ...textStyle.R_16_R, color: colors.gr5 }}>
-                      2022.12.01
-                    </Text>
-                    <Text
-                      sx={{
-                        ...textStyle.H_W3_13,
-                        color: colors.rd,
-                        borderWidth: 1,
-                        borderColor: colors.rd,
-                        paddingHorizontal: 6,
-                        paddingVertical: 3,
-                        borderRadius: 20,
-                      }}
-                    >
-                      メンテナンス
-                    </Text>
+                    <VStack>
+                      <HStack alignItems="center" gap={12} mb={8} maxWidth={'80%'}>
+                        <Text sx={{ ...textStyle.R_16_R, color: colors.gr5 }}>
+                          {notification.date}
+                        </Text>
+                      </HStack>
+                      <Text
+                        sx={{
+                          ...textStyle.H_W6_15,
+                          color: colors.gr1,
+                          maxWidth: '94%',
+                        }}
+                      >
+                        {notification.title || notification.message || notification.notification}
+                      </Text>
+                    </VStack>
+                    <Icon as={ChevronRight} color={colors.rd} size="lg" />
                   </HStack>
-                  <Text
-                    sx={{
-                      ...textStyle.H_W6_15,
-                      color: colors.gr1,
-                    }}
-                  >
-                    キャンペーンのお知らせ
-                  </Text>
-                </VStack>
-                <Icon as={ChevronRight} color={colors.rd} size="lg" />
-              </HStack>
-            </TouchableOpacity>
-            <Divider my={16} />
-            <TouchableOpacity
-              onPress={() => {
-                router.push('/announcement-detail/3');
-              }}
-            >
-              <HStack
-                justifyContent="space-between"
-                alignItems="center"
-                paddingHorizontal={1}
-              >
-                <VStack>
-                  <HStack alignItems="center" gap={12} mb={8}>
-                    <Text sx={{ ...textStyle.R_16_R, color: colors.gr5 }}>
-                      2022.12.01
-                    </Text>
-                    <Text
-                      sx={{
-                        ...textStyle.H_W3_13,
-                        color: colors.rd,
-                        borderWidth: 1,
-                        borderColor: colors.rd,
-                        paddingHorizontal: 6,
-                        paddingVertical: 3,
-                        borderRadius: 20,
-                      }}
-                    >
-                      メンテナンス
-                    </Text>
-                  </HStack>
-                  <Text
-                    sx={{
-                      ...textStyle.H_W6_15,
-                      color: colors.gr1,
-                      maxWidth: '94%',
-                    }}
-                  >
-                    2022年11月30日から12月01日：システムメンテナンスのお知らせ
-                  </Text>
-                </VStack>
-                <Icon as={ChevronRight} color={colors.rd} size="lg" />
-              </HStack>
-            </TouchableOpacity>
-            <Divider my={16} />
+                </TouchableOpacity>
+                <Divider my={16} />
+              </VStack>
+            ))}
+            {notifications.length === 0 && (
+              <Text sx={{ ...textStyle.H_W3_15, color: colors.gr5 }}>
+                {isSyncing ? '読み込み中...' : 'お知らせはありません'}
+              </Text>
+            )}
           </VStack>
         </VStack>
       </ScrollView>
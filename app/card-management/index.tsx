@@ -10,13 +10,16 @@ import { LinearGradient } from 'expo-linear-gradient';
 import { Stack, useRouter } from 'expo-router';
 import { StatusBar } from 'expo-status-bar';
 import { ChevronLeft, Plus } from 'lucide-react-native';
-import { useState } from 'react';
-import { Platform, TouchableOpacity } from 'react-native';
+import { useEffect, useState } from 'react';
+import { NativeModules, Platform, TouchableOpacity } from 'react-native';
 import { SafeAreaProvider } from 'react-native-safe-area-context';
 import { CardListItem } from '../../src/components';
 import CustomModal from '../../src/components/CustomModal';
 import { colors } from '../../src/theme/colors';
 import { textStyle } from '../../src/theme/text-style';
+import type { YellPayModule } from '../../src/types/YellPay';
+
+const { YellPay }: { YellPay: YellPayModule } = NativeModules;
 
 interface CardInterface {
   cardType: string;
@@ -25,11 +28,48 @@ interface CardInterface {
   expiryDate: string;
 }
 
+const CARDS: (CardInterface & { isDefault?: boolean; modalTitle: string })[] = [
+  {
+    cardType: 'visa',
+    cardName: 'Visa Platinum Card',
+    cardNumber: '****2362',
+    expiryDate: '00/00',
+    isDefault: true,
+    modalTitle: 'メインカードに設定',
+  },
+  {
+    cardType: 'mastercard',
+    cardName: 'Mastercard Platinum Card',
+    cardNumber: '****2362',
+    expiryDate: '00/00',
+    modalTitle: 'メインカードに設定',
+  },
+  {
+    cardType: 'jcb',
+    cardName: 'JCB Platinum Card',
+    cardNumber: '****2362',
+    expiryDate: '00/00',
+    modalTitle: 'カードを削除',
+  },
+];
+
 const CardManagement = () => {
   const router = useRouter();
   const [isModalVisible, setIsModalVisible] = useState(false);
   const [modalTitle, setModalTitle] = useState<string>('');
   const [modalContent, setModalContent] = useState<React.ReactNode>(null);
+  const [cardImages, setCardImages] = useState<(string | null)[]>([]);
+
+  // Render every card face in one native pass; repeat visits are served from the image cache
+  useEffect(() => {
+    if (Platform.OS !== 'ios') return;
+    YellPay.renderCardImages(
+      CARDS.map(({ cardNumber, expiryDate }) => ({ cardNumber, expiryDate })),
+      0,
+    )
+      .then((result) => setCardImages(result.map((item) => item.uri)))
+      .catch((error) => console.error('❌ renderCardImages error:', error));
+  }, []);
   const defaultModal = () => {
     return (
       <VStack
@@ -180,7 +220,7 @@ const CardManagement = () => {
       </VStack>
     );
   };
-  const cardDetailModal = (card: CardInterface) => {
+  const cardDetailModal = (card: CardInterface, cardImageUri?: string | null) => {
     return (
       <View paddingVertical={40}>
         <CardListItem
@@ -188,6 +228,7 @@ const CardManagement = () => {
           cardName={card?.cardName}
           cardNumber={card?.cardNumber}
           expiryDate={card?.expiryDate}
+          cardImageUri={cardImageUri}
           isModal
         />
         <VStack mt={36} gap={16}>
@@ -349,61 +390,22 @@ const CardManagement = () => {
           {modalContent}
         </CustomModal>
         <View px={16} py={24}>
-          <CardListItem
-            cardType="visa"
-            cardName="Visa Platinum Card"
-            cardNumber="****2362"
-            expiryDate="00/00"
-            isDefault
-            onPress={() => {
-              setIsModalVisible(true);
-              setModalTitle('メインカードに設定');
-              setModalContent(
-                cardDetailModal({
-                  cardType: 'visa',
-                  cardName: 'Visa Platinum Card',
-                  cardNumber: '****2362',
-                  expiryDate: '00/00',
-                })
-              );
-            }}
-          />
-          <CardListItem
-            cardType="mastercard"
-            cardName="Mastercard Platinum Card"
-            cardNumber="****2362"
-            expiryDate="00/00"
-            onPress={() => {
-              setIsModalVisible(true);
-              setModalTitle('メインカードに設定');
-              setModalContent(
-                cardDetailModal({
-                  cardType: 'mastercard',
-                  cardName: 'Mastercard Platinum Card',
-                  cardNumber: '****2362',
-                  expiryDate: '00/00',
-                })
-              );
-            }}
-          />
-          <CardListItem
-            cardType="jcb"
-            cardName="JCB Platinum Card"
-            cardNumber="****2362"
-            expiryDate="00/00"
-            onPress={() => {
-              setIsModalVisible(true);
-              setModalTitle('カードを削除');
-              setModalContent(
-                cardDetailModal({
-                  cardType: 'jcb',
-                  cardName: 'JCB Platinum Card',
-                  cardNumber: '****2362',
-                  expiryDate: '00/00',
-                })
-              );
-            }}
-          />
+          {CARDS.map((card, index) => (
+            <CardListItem
+              key={card.cardType}
+              cardType={card.cardType}
+              cardName={card.cardName}
+              cardNumber={card.cardNumber}
+              expiryDate={card.expiryDate}
+              isDefault={card.isDefault}
+              cardImageUri={cardImages[index]}
+              onPress={() => {
+                setIsModalVisible(true);
+                setModalTitle(card.modalTitle);
+                setModalContent(cardDetailModal(card, cardImages[index]));
+              }}
+            />
+          ))}
           <TouchableOpacity
             onPress={() => {
               router.push('/card-registration');
@@ -3,7 +3,7 @@ import { yupResolver } from '@hookform/resolvers/yup';
 import { LinearGradient } from 'expo-linear-gradient';
 import { Stack, useRouter } from 'expo-router';
 import { StatusBar } from 'expo-status-bar';
-import { useRef, useState } from 'react';
+import { useEffect, useRef, useState } from 'react';
 import { Controller, useForm } from 'react-hook-form';
 import {
   ActivityIndicator,
@@ -24,7 +24,8 @@ import { RootState } from '../../src/redux/store';
 import { colors } from '../../src/theme/colors';
 import { textStyle } from '../../src/theme/text-style';
 import type { YellPayModule } from '../../src/types/YellPay';
-import { validateCardRegistration, validateAndShowError } from '../../src/utils/yellPayFlow';
+import { invalidateAuthSessionOnError } from '../../src/utils/authSession';
+import { isFlowCancelled, startUiFlow, UiFlowHandle, validateAndShowError, validateCardRegistration } from '../../src/utils/yellPayFlow';
 
 const { YellPay }: { YellPay: YellPayModule } = NativeModules;
 
@@ -55,8 +56,16 @@ const CardRegistration = () => {
   const [isRegistering, setIsRegistering] = useState(false);
   const router = useRouter();
   const scrollViewRef = useRef<any>(null);
+  const registerFlowRef = useRef<UiFlowHandle<unknown> | null>(null);
   const { userId, isAuthenticated } = useAppSelector((state: RootState) => state.registration);
 
+  // Leaving the screen mid-registration closes the SDK card screens instead of leaving them up
+  useEffect(() => {
+    return () => {
+      registerFlowRef.current?.cancel();
+    };
+  }, []);
+
   const {
     control,
     handleSubmit,
@@ -530,11 +539,13 @@ const CardRegistration = () => {
                           // On iOS, call the SDK registerCard method
                           // The SDK will show its own UI for card input
                           console.log('Calling YellPay.registerCard for iOS...');
-                          const result = await YellPay.registerCard(
+                          const flow = startUiFlow(YellPay, 'registerCard', () => YellPay.registerCard(
                             userId, // uuid
                             0, // userNo (typically 0)
                             userId // payUserId (same as userId)
-                          );
+                          ));
+                          registerFlowRef.current = flow;
+                          const result = await flow.promise;
                           console.log('Card registration result:', result);
                           setCurrentStep(2);
                         } else {
@@ -542,13 +553,16 @@ const CardRegistration = () => {
                           setCurrentStep(2);
                         }
                       } catch (error: any) {
+                        if (isFlowCancelled(error)) return;
                         console.error('Card registration error:', error);
+                        invalidateAuthSessionOnError(error, userId);
                         Alert.alert(
                           'エラー',
                           error?.message || 'カード登録に失敗しました。もう一度お試しください。',
                           [{ text: 'OK' }]
                         );
                       } finally {
+                        registerFlowRef.current = null;
                         setIsRegistering(false);
                       }
                     }}
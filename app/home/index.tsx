@@ -8,8 +8,8 @@ import {
 } from '@gluestack-ui/themed';
 import { Stack, useRouter } from 'expo-router';
 import { StatusBar } from 'expo-status-bar';
-import { useEffect, useState } from 'react';
-import { ActivityIndicator, Alert, NativeModules, RefreshControl, TouchableOpacity } from 'react-native';
+import { useEffect, useRef, useState } from 'react';
+import { ActivityIndicator, Alert, InteractionManager, NativeModules, Platform, RefreshControl, TouchableOpacity } from 'react-native';
 import { SafeAreaView } from 'react-native-safe-area-context';
 import { BannerSlider, Card } from '../../src/components';
 import { useAppDispatch, useAppSelector } from '../../src/redux/hooks';
@@ -18,20 +18,90 @@ import { RootState } from '../../src/redux/store';
 import { useLazyGetUserProfileQuery } from '../../src/services/appApi';
 import { colors } from '../../src/theme/colors';
 import { textStyle } from '../../src/theme/text-style';
-import type { YellPayModule } from '../../src/types/YellPay';
+import type { YellPayBatchOperation, YellPayModule } from '../../src/types/YellPay';
+import { clearAuthSession } from '../../src/utils/authSession';
+import { getPaymentPlan, PaymentPrefetch, prefetchPaymentPlan, preparePaymentPlans } from '../../src/utils/paymentFlowPlan';
 
 const { YellPay }: { YellPay: YellPayModule } = NativeModules;
 
 let hasInitializedHome = false;
 
+// iOS runs the certificate fetch as a cancellable request so leaving Home abandons it
+const CERTIFICATES_REQUEST_ID = 'home.certificates';
+
 const Home = () => {
   const router = useRouter();
   const dispatch = useAppDispatch();
   const [isLoading, setIsLoading] = useState(true);
   const [refreshing, setRefreshing] = useState(false);
-  const { userId, token, user, certificates, isAuthenticated } = useAppSelector((state: RootState) => state.registration);
+  const { userId, token, user, certificates, certificatesUpdatedAt, isAuthenticated } = useAppSelector((state: RootState) => state.registration);
   const [getUserProfile, { isLoading: isProfileLoading }] = useLazyGetUserProfileQuery();
   console.log('userId', userId, 'user', user);
+  // Payment prefetch steps already covered by the cold-start batch, for the user it ran for
+  const coldStartPrefetched = useRef<{ userId: string | null; steps: PaymentPrefetch[] }>({ userId: null, steps: [] });
+
+  // setCertificates keeps the stored array when nothing changed
+  const applyCertificates = (result: unknown) => {
+    // Handle both array and string responses
+    const certArray = Array.isArray(result) ? result : [];
+
+    if (certArray.length > 0) {
+      console.log(`✅ Found ${certArray.length} certificate(s):`);
+      certArray.forEach((cert: any, index: number) => {
+        console.log(`   Certificate ${index + 1}:`, cert);
+      });
+    } else {
+      console.log('ℹ️  No certificates found. User needs to register a card first via registerCard()');
+    }
+    dispatch(setCertificates(certArray));
+  };
+
+  // Fetches certificates from the SDK; a failed fetch leaves the cached certificates in place
+  const revalidateCertificates = async (id: string) => {
+    try {
+      console.log('📊 Calling YellPay.getUserInfo for userId:', id);
+      const result = Platform.OS === 'ios'
+        ? await YellPay.request('getUserInfo', id, 0, CERTIFICATES_REQUEST_ID)
+        : await YellPay.getUserInfo(id);
+      applyCertificates(result);
+    } catch (error: any) {
+      if (error?.code === 'REQUEST_CANCELLED') return;
+      console.error('❌ getUserInfo error:', error);
+    }
+  };
+
+  // Cold start: certificates and the payment plan's limit lookup go out in one batch
+  // round trip; the idle prefetch below then skips what the batch already fetched
+  const coldStartFetch = async (id: string) => {
+    coldStartPrefetched.current = { userId: id, steps: [] };
+    const operations: YellPayBatchOperation[] = [{ method: 'getUserInfo', userId: id }];
+    if (getPaymentPlan('payment').prefetch.includes('limitAmount')) {
+      operations.push({ method: 'getConfirmLimitAmount', userId: id });
+    }
+    try {
+      console.log('📊 Cold start batch:', operations.map((op) => op.method).join(', '));
+      const [certificatesResult, limitResult] = await YellPay.batch(operations);
+      if (certificatesResult.ok) {
+        applyCertificates(certificatesResult.result);
+      } else {
+        console.error('❌ getUserInfo error:', certificatesResult.message);
+      }
+      const prefetched = coldStartPrefetched.current;
+      if (limitResult?.ok && prefetched.userId === id && !prefetched.steps.includes('limitAmount')) {
+        prefetched.steps.push('limitAmount');
+      }
+    } catch (error) {
+      console.error('❌ Cold start batch error:', error);
+    }
+  };
+
+  useEffect(() => {
+    return () => {
+      if (Platform.OS === 'ios') {
+        YellPay.cancelRequest(CERTIFICATES_REQUEST_ID).catch(() => {});
+      }
+    };
+  }, []);
 
   // Combined initialization: Initialize SDK first, then validate token
   useEffect(() => {
@@ -79,34 +149,18 @@ const Home = () => {
           console.log('UserId already exists in state:', userId);
         }
 
+        // Flow plans depend only on the merchant config the SDK was initialized with
+        preparePaymentPlans();
+
         // Get User Info from YellPay SDK (certificates)
         // Note: Certificates are created when user registers a card via registerCard()
+        // Persisted certificates render immediately; only a first launch waits on the SDK
         if (userId) {
-          try {
-            console.log('📊 Calling YellPay.getUserInfo for userId:', userId);
-            const certificates = await YellPay.getUserInfo(userId);
-            console.log('test data', certificates);
-            // Handle both array and string responses
-            const certArray = Array.isArray(certificates) ? certificates : [];
-
-            if (certArray.length > 0) {
-              console.log(`✅ Found ${certArray.length} certificate(s):`);
-              certArray.forEach((cert: any, index: number) => {
-                console.log(`   Certificate ${index + 1}:`, cert);
-              });
-
-              // Store certificates in Redux
-              dispatch(setCertificates(certArray));
-              console.log('✅ Certificates stored in Redux state');
-            } else {
-              console.log('ℹ️  No certificates found. User needs to register a card first via registerCard()');
-              // Clear certificates in Redux if empty
-              dispatch(setCertificates([]));
-            }
-          } catch (error) {
-            console.error('❌ getUserInfo error:', error);
-            // Clear certificates on error
-            dispatch(setCertificates([]));
+          if (certificatesUpdatedAt) {
+            console.log('📊 Showing cached certificates from', certificatesUpdatedAt, '- revalidating');
+            coldStartFetch(userId);
+          } else {
+            await coldStartFetch(userId);
           }
         }
 
@@ -129,6 +183,8 @@ const Home = () => {
                     text: 'OK',
                     onPress: () => {
                       dispatch(clearRegistration());
+                      clearAuthSession(userId);
+                      YellPay.clearMainCardCache().catch(() => {});
                       router.replace('/login');
                     },
                   },
@@ -157,6 +213,19 @@ const Home = () => {
     hasInitializedHome = true;
   }, []); // Empty deps array - only run once on mount
 
+  // Once home is idle with a registered card, fetch what the planned payment flow's
+  // screens need (main card, limit amount, warm hosts) so the pay tap goes straight to the UI
+  useEffect(() => {
+    if (isLoading || !userId || !certificates?.length) return;
+    const task = InteractionManager.runAfterInteractions(() => {
+      const plan = getPaymentPlan('payment');
+      const prefetched = coldStartPrefetched.current;
+      prefetchPaymentPlan(plan, YellPay, userId, prefetched.userId === userId ? prefetched.steps : [])
+        .then((status) => console.log(`💳 prefetch ${plan.variant}:`, status));
+    });
+    return () => task.cancel();
+  }, [isLoading, userId, certificates?.length]);
+
   // Handle pull-to-refresh
   const onRefresh = async () => {
     try {
@@ -164,32 +233,7 @@ const Home = () => {
 
       // Refresh certificates if userId exists
       if (userId) {
-        try {
-          console.log('📊 Refreshing certificates for userId:', userId);
-          const certificates = await YellPay.getUserInfo(userId);
-          console.log('Refreshed certificates:', certificates);
-          // Handle both array and string responses
-          const certArray = Array.isArray(certificates) ? certificates : [];
-
-          if (certArray.length > 0) {
-            console.log(`✅ Found ${certArray.length} certificate(s):`);
-            certArray.forEach((cert: any, index: number) => {
-              console.log(`   Certificate ${index + 1}:`, cert);
-            });
-
-            // Store certificates in Redux
-            dispatch(setCertificates(certArray));
-            console.log('✅ Certificates stored in Redux state');
-          } else {
-            console.log('ℹ️  No certificates found.');
-            // Clear certificates in Redux if empty
-            dispatch(setCertificates([]));
-          }
-        } catch (error) {
-          console.error('❌ getUserInfo error:', error);
-          // Clear certificates on error
-          dispatch(setCertificates([]));
-        }
+        await revalidateCertificates(userId);
       }
 
       // Refresh user profile if token exists
@@ -210,6 +254,8 @@ const Home = () => {
                   text: 'OK',
                   onPress: () => {
                     dispatch(clearRegistration());
+                    clearAuthSession(userId);
+                    YellPay.clearMainCardCache().catch(() => {});
                     router.replace('/login');
                   },
                 },
@@ -10,15 +10,20 @@ import {
 import { Stack, useRouter } from 'expo-router';
 import { StatusBar } from 'expo-status-bar';
 import { ChevronRight } from 'lucide-react-native';
-import { Alert, TouchableOpacity } from 'react-native';
-import { useDispatch } from 'react-redux';
+import { Alert, NativeModules, TouchableOpacity } from 'react-native';
+import { useDispatch, useSelector } from 'react-redux';
 import { clearRegistration } from '../../src/redux/slice/auth/registrationSlice';
 import { colors } from '../../src/theme/colors';
 import { textStyle } from '../../src/theme/text-style';
+import type { YellPayModule } from '../../src/types/YellPay';
+import { clearAuthSession } from '../../src/utils/authSession';
+
+const { YellPay }: { YellPay: YellPayModule } = NativeModules;
 
 const Settings = () => {
   const router = useRouter();
   const dispatch = useDispatch();
+  const userId = useSelector((state: any) => state.registration.userId);
   return (
     <SafeAreaView style={{ flex: 1 }}>
       <ScrollView
@@ -197,6 +202,8 @@ const Settings = () => {
                       style: 'destructive',
                       onPress: () => {
                         dispatch(clearRegistration());
+                        clearAuthSession(userId);
+                        YellPay.clearMainCardCache().catch(() => {});
                         router.replace('/');
                       },
                     },
@@ -0,0 +1,190 @@
+import Foundation
+
+// async/await front end for the RoutePay read APIs. Every wrapper calls the same
+// SDK overload (and so the same backend) as the matching direct bridge method,
+// decodes into the YellPayCore structs, and goes through YellPayCompletionEngine so
+// timeouts, metrics and the circuit breaker see it like any callback-based call.
+//
+// Cancelling the awaiting Task resumes it with CancellationError immediately and
+// releases its engine slot without counting an outcome. RouteCode has no cancel
+// entry point, so a late SDK callback is dropped. Callers presenting SDK UI can pass
+// `onCancel` to dismiss it.
+enum YellPayAsync {
+
+    struct SDKError: LocalizedError {
+        let operation: String
+        let status: Int
+        let underlying: Error?
+
+        var errorDescription: String? {
+            return "Error \(status): \(underlying?.localizedDescription ?? "Unknown error")"
+        }
+    }
+
+    struct TimeoutError: LocalizedError {
+        let operation: String
+
+        var errorDescription: String? {
+            return "\(operation) timed out"
+        }
+    }
+
+    struct CircuitOpenError: LocalizedError {
+        let operation: String
+
+        var errorDescription: String? {
+            return "\(operation) has failed too many times"
+        }
+    }
+
+    // Resumes the continuation at most once across success, failure, timeout and cancellation
+    private final class Resumption<T> {
+        private let lock = NSLock()
+        private var continuation: CheckedContinuation<T, Error>?
+        private var call: YellPayCompletionEngine.Call?
+        private var finished = false
+
+        /// False when the task was cancelled before the call started; the continuation is already resumed.
+        func start(_ continuation: CheckedContinuation<T, Error>) -> Bool {
+            lock.lock()
+            guard !finished else {
+                lock.unlock()
+                continuation.resume(throwing: CancellationError())
+                return false
+            }
+            self.continuation = continuation
+            lock.unlock()
+            return true
+        }
+
+        func attach(_ call: YellPayCompletionEngine.Call) {
+            lock.lock()
+            self.call = call
+            lock.unlock()
+        }
+
+        func resume(_ result: Result<T, Error>) {
+            lock.lock()
+            guard !finished else {
+                lock.unlock()
+                return
+            }
+            finished = true
+            let pending = continuation
+            continuation = nil
+            lock.unlock()
+            pending?.resume(with: result)
+        }
+
+        /// True when this cancelled a call that was still waiting on the SDK.
+        func cancel() -> Bool {
+            lock.lock()
+            let wasRunning = !finished && call?.cancel() == true
+            lock.unlock()
+            resume(.failure(CancellationError()))
+            return wasRunning
+        }
+    }
+
+    /// Runs one SDK call as an async function. `start` receives success/failure sinks and
+    /// is invoked on main when `onMain` is set, otherwise on the operation's execution queue.
+    static func call<T>(
+        _ operation: String,
+        timeout: TimeInterval,
+        onMain: Bool = false,
+        onCancel: (() -> Void)? = nil,
+        _ start: @escaping (_ success: @escaping (T) -> Void, _ failure: @escaping (Int, Error?) -> Void) -> Void
+    ) async throws -> T {
+        let resumption = Resumption<T>()
+        return try await withTaskCancellationHandler {
+            try await withCheckedThrowingContinuation { (continuation: CheckedContinuation<T, Error>) in
+                guard resumption.start(continuation) else { return }
+                // Gate only once the call is certain to start, so a task cancelled early never holds a probe slot
+                guard YellPayCircuitBreaker.shared.allow(operation) else {
+                    resumption.resume(.failure(CircuitOpenError(operation: operation)))
+                    return
+                }
+                let call = YellPayCompletionEngine.shared.begin(operation, timeout: timeout) {
+                    resumption.resume(.failure(TimeoutError(operation: operation)))
+                }
+                resumption.attach(call)
+                let queue = onMain ? DispatchQueue.main : YellPay.executionQueue(for: operation)
+                queue.async {
+                    autoreleasepool {
+                        start({ value in
+                            guard call.complete() else { return }
+                            resumption.resume(.success(value))
+                        }, { status, error in
+                            guard call.fail() else { return }
+                            resumption.resume(.failure(SDKError(operation: operation, status: status, underlying: error)))
+                        })
+                    }
+                }
+            }
+        } onCancel: {
+            if resumption.cancel(), let onCancel = onCancel {
+                DispatchQueue.main.async(execute: onCancel)
+            }
+        }
+    }
+
+    // MARK: - RoutePay
+
+    static func userInfo(_ userId: String) async throws -> [YellPayCore.Certificate] {
+        return try await call("getUserInfo", timeout: 30) { success, failure in
+            RoutePay.callGetUserInfoUserId(
+                userId,
+                environmentMode: EnvironmentModeEnum.production,
+                callSuccess: { certificates in
+                    success((certificates ?? []).compactMap(YellPayCore.Certificate.init))
+                },
+                callFailed: { status, error in failure(Int(status), error) }
+            )
+        }
+    }
+
+    static func notifications(_ userId: String, lastUpdate: Int) async throws -> (lastUpdate: Int, notifications: [YellPayCore.Notification]) {
+        return try await call("getNotification", timeout: 30) { success, failure in
+            RoutePay.callGetNotificationUserId(
+                userId,
+                lastUpdate: lastUpdate,
+                callSuccess: { lastUpdateNotification, notifications in
+                    success((lastUpdateNotification, (notifications ?? []).compactMap(YellPayCore.Notification.init)))
+                },
+                callFailed: { status, error in failure(Int(status), error) }
+            )
+        }
+    }
+
+    static func information(_ userId: String, lastUpdate: Int) async throws -> YellPayCore.InformationResponse {
+        return try await call("getInformation", timeout: 30) { success, failure in
+            RoutePay.callGetInformationUserId(
+                userId,
+                lastUpdateNotification: lastUpdate,
+                callSuccess: { userInfo, alert, bannerInformation, lastUpdateNotification, notifications in
+                    success(YellPayCore.InformationResponse(
+                        userInfo: userInfo,
+                        alert: alert,
+                        bannerInformation: bannerInformation,
+                        lastUpdate: lastUpdateNotification,
+                        notifications: notifications
+                    ))
+                },
+                callFailed: { status, error in failure(Int(status), error) }
+            )
+        }
+    }
+
+    static func confirmLimitAmount(_ userId: String) async throws -> YellPayCore.ConfirmLimitAmountResponse {
+        return try await call("getConfirmLimitAmount", timeout: 30) { success, failure in
+            RoutePay.callGetConfirmLimitAmountUserId(
+                userId,
+                environmentMode: EnvironmentModeEnum.production,
+                callSuccess: { userInfo, alert in
+                    success(YellPayCore.ConfirmLimitAmountResponse(userInfo: userInfo, alert: alert))
+                },
+                callFailed: { status, error in failure(Int(status), error) }
+            )
+        }
+    }
+}
@@ -0,0 +1,148 @@
+import CryptoKit
+import Foundation
+import UIKit
+
+// Memory + disk cache for card faces produced by RoutePay.generateCardWithNumber.
+// Entries are keyed by masked number + expiry + scale and stored as PNG files
+// under Caches so React Native can display them by file URI without the SDK
+// re-rasterizing the same card on every list render.
+final class YellPayCardImageCache {
+
+    static let shared = YellPayCardImageCache()
+
+    struct CardFace {
+        let cardNumber: String
+        let expiryDate: String
+    }
+
+    // Budgets: memory is decoded bitmaps, disk is encoded PNG bytes
+    static let memoryBudgetBytes = 16 * 1024 * 1024
+    static let diskBudgetBytes = 32 * 1024 * 1024
+
+    private let memory = NSCache<NSString, UIImage>()
+    private let ioQueue = DispatchQueue(label: "com.yellpay.card-image-cache", qos: .userInitiated)
+    private let directory: URL?
+
+    private init() {
+        memory.totalCostLimit = YellPayCardImageCache.memoryBudgetBytes
+        directory = FileManager.default.urls(for: .cachesDirectory, in: .userDomainMask).first?
+            .appendingPathComponent("YellPay/cards", isDirectory: true)
+        if let directory = directory {
+            try? FileManager.default.createDirectory(at: directory, withIntermediateDirectories: true)
+        }
+    }
+
+    // Only the last four digits take part in the key; the full number never touches disk
+    static func maskedNumber(_ cardNumber: String) -> String {
+        let digits = cardNumber.filter { $0.isNumber }
+        return "\(digits.count):\(digits.suffix(4))"
+    }
+
+    static func key(for card: CardFace, scale: CGFloat) -> String {
+        let raw = "\(maskedNumber(card.cardNumber))|\(card.expiryDate)|\(Int(scale * 100))"
+        return SHA256.hash(data: Data(raw.utf8)).map { String(format: "%02x", $0) }.joined()
+    }
+
+    private func fileURL(for key: String) -> URL? {
+        return directory?.appendingPathComponent("\(key).png")
+    }
+
+    /// Returns file URIs for every card, in input order. Cache hits are served
+    /// without touching the SDK; misses are rasterized in one main-thread pass
+    /// (the SDK draws with UIKit) and encoded/written off the main thread.
+    func render(_ cards: [CardFace], scale: CGFloat, completion: @escaping ([String?]) -> Void) {
+        ioQueue.async {
+            let keys = cards.map { YellPayCardImageCache.key(for: $0, scale: scale) }
+            var uris = [String?](repeating: nil, count: cards.count)
+            var misses: [Int] = []
+
+            for (index, key) in keys.enumerated() {
+                if let url = self.fileURL(for: key), FileManager.default.fileExists(atPath: url.path) {
+                    // Touch so budget eviction keeps recently used faces
+                    try? FileManager.default.setAttributes([.modificationDate: Date()], ofItemAtPath: url.path)
+                    uris[index] = url.absoluteString
+                } else {
+                    misses.append(index)
+                }
+            }
+
+            guard !misses.isEmpty else {
+                completion(uris)
+                return
+            }
+
+            DispatchQueue.main.async {
+                var rendered: [(Int, UIImage)] = []
+                for index in misses {
+                    let key = keys[index] as NSString
+                    if let cached = self.memory.object(forKey: key) {
+                        rendered.append((index, cached))
+                        continue
+                    }
+                    let card = cards[index]
+                    guard let generated = RoutePay.generateCard(withNumber: card.cardNumber, expiryDate: card.expiryDate) else {
+                        continue
+                    }
+                    let image = YellPayCardImageCache.rescaled(generated, to: scale)
+                    let cost = Int(image.size.width * image.scale * image.size.height * image.scale * 4)
+                    self.memory.setObject(image, forKey: key, cost: cost)
+                    rendered.append((index, image))
+                }
+
+                self.ioQueue.async {
+                    for (index, image) in rendered {
+                        guard let url = self.fileURL(for: keys[index]), let data = image.pngData() else { continue }
+                        do {
+                            try data.write(to: url, options: .atomic)
+                            uris[index] = url.absoluteString
+                        } catch {
+                            print("💥 YellPayCardImageCache - Failed to write \(url.lastPathComponent): \(error)")
+                        }
+                    }
+                    self.evictIfNeeded()
+                    completion(uris)
+                }
+            }
+        }
+    }
+
+    private static func rescaled(_ image: UIImage, to scale: CGFloat) -> UIImage {
+        guard scale > 0, image.scale != scale else { return image }
+        let format = UIGraphicsImageRendererFormat()
+        format.scale = scale
+        return UIGraphicsImageRenderer(size: image.size, format: format).image { _ in
+            image.draw(in: CGRect(origin: .zero, size: image.size))
+        }
+    }
+
+    // Must be called on ioQueue. Drops least recently used files until under budget.
+    private func evictIfNeeded() {
+        guard let directory = directory,
+              let files = try? FileManager.default.contentsOfDirectory(
+                at: directory,
+                includingPropertiesForKeys: [.fileSizeKey, .contentModificationDateKey]
+              ) else { return }
+
+        var entries: [(url: URL, size: Int, modified: Date)] = files.compactMap { url in
+            guard let values = try? url.resourceValues(forKeys: [.fileSizeKey, .contentModificationDateKey]) else { return nil }
+            return (url, values.fileSize ?? 0, values.contentModificationDate ?? .distantPast)
+        }
+        var total = entries.reduce(0) { $0 + $1.size }
+        guard total > YellPayCardImageCache.diskBudgetBytes else { return }
+
+        entries.sort { $0.modified < $1.modified }
+        for entry in entries where total > YellPayCardImageCache.diskBudgetBytes {
+            try? FileManager.default.removeItem(at: entry.url)
+            total -= entry.size
+        }
+    }
+
+    func clear() {
+        memory.removeAllObjects()
+        ioQueue.async {
+            guard let directory = self.directory else { return }
+            try? FileManager.default.removeItem(at: directory)
+            try? FileManager.default.createDirectory(at: directory, withIntermediateDirectories: true)
+        }
+    }
+}
@@ -0,0 +1,191 @@
+import Foundation
+
+// Per-operation circuit breaker. Outcomes of the last `windowSize` calls decide
+// when to open; an open breaker rejects calls until its cool-down elapses, then
+// lets `halfOpenProbes` calls through. Probe success closes it, probe failure
+// re-opens it with a doubled cool-down. The spec comes from JS
+// (src/constants/circuitBreaker.ts) so Android and iOS share the same thresholds.
+final class YellPayCircuitBreaker {
+
+    static let shared = YellPayCircuitBreaker()
+
+    /// Read-only calls gated by the breaker (same set as Android). Auth and payment flows always
+    /// run, and their outcomes are never recorded, so they cannot show up as blocked.
+    static let gatedOperations: Set<String> = [
+        "getHistory", "cardSelect", "getMainCreditCard", "getUserInfo", "viewCertificate",
+        "getNotification", "getInformation", "getConfirmLimitAmount", "validateAuthenticationStatus"
+    ]
+
+    struct Spec {
+        var windowSize = 20
+        var minimumCalls = 5
+        var failureRateThreshold = 0.5
+        var baseCooldown: TimeInterval = 5
+        var maxCooldown: TimeInterval = 300
+        var halfOpenProbes = 1
+
+        init() {}
+
+        init(_ raw: [String: Any]) {
+            let defaults = Spec()
+            windowSize = max(1, (raw["windowSize"] as? NSNumber)?.intValue ?? defaults.windowSize)
+            minimumCalls = max(1, (raw["minimumCalls"] as? NSNumber)?.intValue ?? defaults.minimumCalls)
+            failureRateThreshold = (raw["failureRateThreshold"] as? NSNumber)?.doubleValue ?? defaults.failureRateThreshold
+            baseCooldown = ((raw["baseCooldownMs"] as? NSNumber)?.doubleValue).map { $0 / 1000 } ?? defaults.baseCooldown
+            maxCooldown = ((raw["maxCooldownMs"] as? NSNumber)?.doubleValue).map { $0 / 1000 } ?? defaults.maxCooldown
+            halfOpenProbes = max(1, (raw["halfOpenProbes"] as? NSNumber)?.intValue ?? defaults.halfOpenProbes)
+        }
+    }
+
+    enum State: String {
+        case closed
+        case open
+        case halfOpen = "half-open"
+    }
+
+    private struct Circuit {
+        var state = State.closed
+        var outcomes: [Bool] = []   // true = failure, oldest first
+        var trips = 0               // consecutive opens without a full recovery
+        var openedAt = Date.distantPast
+        var probesInFlight = 0
+        var probeSuccesses = 0
+    }
+
+    private let lock = NSLock()
+    private var spec = Spec()
+    private var circuits: [String: Circuit] = [:]
+
+    private init() {}
+
+    func configure(_ spec: Spec) {
+        lock.lock()
+        self.spec = spec
+        lock.unlock()
+    }
+
+    private func cooldown(for circuit: Circuit) -> TimeInterval {
+        let exponent = Double(max(0, circuit.trips - 1))
+        return min(spec.maxCooldown, spec.baseCooldown * pow(2, exponent))
+    }
+
+    // Must hold lock
+    private func transition(_ key: String, _ circuit: inout Circuit, to state: State) {
+        guard circuit.state != state else { return }
+        circuit.state = state
+        switch state {
+        case .open:
+            circuit.trips += 1
+            circuit.openedAt = Date()
+        case .halfOpen:
+            circuit.openedAt = Date()
+            circuit.probesInFlight = 0
+            circuit.probeSuccesses = 0
+        case .closed:
+            circuit.trips = 0
+            circuit.outcomes.removeAll()
+        }
+        YellPayMetrics.shared.recordBreakerTransition(key, to: state.rawValue)
+        print("🔌 YellPay - Circuit \(key) → \(state.rawValue)")
+    }
+
+    /// False while the circuit is open (or half-open with all probe slots taken).
+    func allow(_ key: String) -> Bool {
+        lock.lock()
+        defer { lock.unlock() }
+        var circuit = circuits[key] ?? Circuit()
+        defer { circuits[key] = circuit }
+
+        if circuit.state == .open {
+            guard Date().timeIntervalSince(circuit.openedAt) >= cooldown(for: circuit) else { return false }
+            transition(key, &circuit, to: .halfOpen)
+        }
+        if circuit.state == .halfOpen {
+            // A probe that never reported back (rejected before reaching the SDK) frees its slot after a cool-down
+            if circuit.probesInFlight >= spec.halfOpenProbes, Date().timeIntervalSince(circuit.openedAt) >= cooldown(for: circuit) {
+                circuit.openedAt = Date()
+                circuit.probesInFlight = 0
+            }
+            guard circuit.probesInFlight < spec.halfOpenProbes else { return false }
+            circuit.probesInFlight += 1
+        }
+        return true
+    }
+
+    /// Frees the half-open probe slot of a call that ended without an outcome (caller or user cancel).
+    func release(_ key: String) {
+        guard YellPayCircuitBreaker.gatedOperations.contains(key) else { return }
+        lock.lock()
+        defer { lock.unlock() }
+        guard var circuit = circuits[key], circuit.state == .halfOpen else { return }
+        circuit.probesInFlight = max(0, circuit.probesInFlight - 1)
+        circuits[key] = circuit
+    }
+
+    func record(_ key: String, failed: Bool) {
+        guard YellPayCircuitBreaker.gatedOperations.contains(key) else { return }
+        lock.lock()
+        defer { lock.unlock() }
+        var circuit = circuits[key] ?? Circuit()
+        defer { circuits[key] = circuit }
+
+        switch circuit.state {
+        case .halfOpen:
+            if failed {
+                transition(key, &circuit, to: .open)
+            } else {
+                circuit.probeSuccesses += 1
+                if circuit.probeSuccesses >= spec.halfOpenProbes {
+                    transition(key, &circuit, to: .closed)
+                }
+            }
+        case .closed:
+            circuit.outcomes.append(failed)
+            if circuit.outcomes.count > spec.windowSize {
+                circuit.outcomes.removeFirst(circuit.outcomes.count - spec.windowSize)
+            }
+            let failures = circuit.outcomes.filter { $0 }.count
+            if circuit.outcomes.count >= spec.minimumCalls,
+               Double(failures) / Double(circuit.outcomes.count) >= spec.failureRateThreshold {
+                transition(key, &circuit, to: .open)
+            }
+        case .open:
+            // Late result of a call that started before the circuit opened
+            break
+        }
+    }
+
+    func reset() {
+        lock.lock()
+        defer { lock.unlock() }
+        for (key, circuit) in circuits where circuit.state != .closed {
+            YellPayMetrics.shared.recordBreakerTransition(key, to: State.closed.rawValue)
+        }
+        circuits.removeAll()
+    }
+
+    func status() -> [String: Any] {
+        lock.lock()
+        defer { lock.unlock() }
+        var blocked: [String] = []
+        var failures: [String: Int] = [:]
+        var states: [String: Any] = [:]
+        for (key, circuit) in circuits {
+            let failureCount = circuit.outcomes.filter { $0 }.count
+            failures[key] = failureCount
+            if circuit.state == .open {
+                blocked.append(key)
+            }
+            states[key] = [
+                "state": circuit.state.rawValue,
+                "failures": failureCount,
+                "calls": circuit.outcomes.count,
+                "trips": circuit.trips,
+                "retryInMs": circuit.state == .open
+                    ? max(0, (cooldown(for: circuit) - Date().timeIntervalSince(circuit.openedAt)) * 1000)
+                    : 0
+            ]
+        }
+        return ["blockedOperations": blocked, "operationAttempts": failures, "circuits": states]
+    }
+}
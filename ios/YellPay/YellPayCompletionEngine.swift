@@ -0,0 +1,163 @@
+import Foundation
+import os
+
+// Shared timeout tracking for bridge calls. A single timer wheel on a private
+// queue services every pending deadline, so a call costs one table entry rather
+// than its own DispatchWorkItem or DispatchSource. Each call is claimed exactly
+// once: whichever of the SDK callback, failure path or timeout removes it from
+// the pending table first wins, and every later claim is refused.
+final class YellPayCompletionEngine {
+
+    static let shared = YellPayCompletionEngine()
+
+    struct Call: Equatable {
+        fileprivate let id: UInt64
+
+        /// True exactly once per call; callers bail out on false.
+        func complete() -> Bool {
+            return YellPayCompletionEngine.shared.claim(id, failed: false)
+        }
+
+        /// Same as `complete()` for SDK failure paths; also counts a failure for the operation.
+        func fail() -> Bool {
+            return YellPayCompletionEngine.shared.claim(id, failed: true)
+        }
+
+        /// Claims an abandoned call (caller or user cancelled); counts neither success nor failure
+        /// and frees any half-open probe slot it held.
+        func cancel() -> Bool {
+            return YellPayCompletionEngine.shared.claim(id, failed: nil)
+        }
+    }
+
+    private struct Entry {
+        let operation: String
+        let startNanos: UInt64
+        let deadlineTick: UInt64
+        let onTimeout: () -> Void
+    }
+
+    // 250 ms resolution, 256 slots ≈ 64 s per revolution; longer deadlines wait extra rounds
+    private static let tickNanos: UInt64 = 250_000_000
+    private static let slotCount = 256
+
+    private let lock: os_unfair_lock_t
+    private let queue = DispatchQueue(label: "com.yellpay.completion-engine", qos: .userInitiated)
+    private let startNanos = DispatchTime.now().uptimeNanoseconds
+    private var slots = [[UInt64]](repeating: [], count: YellPayCompletionEngine.slotCount)
+    private var pending: [UInt64: Entry] = [:]
+    private var processedTick: UInt64 = 0
+    private var nextId: UInt64 = 0
+    private var timer: DispatchSourceTimer?
+
+    private init() {
+        lock = os_unfair_lock_t.allocate(capacity: 1)
+        lock.initialize(to: os_unfair_lock())
+    }
+
+    private func currentTick() -> UInt64 {
+        return (DispatchTime.now().uptimeNanoseconds - startNanos) / YellPayCompletionEngine.tickNanos
+    }
+
+    /// Registers a call whose `onTimeout` runs on main if nothing claims it within `timeout` seconds.
+    /// Latency, failures and timeouts are reported to YellPayMetrics under `operation`, and to
+    /// YellPayCircuitBreaker when `operation` is one of its gated operations.
+    func begin(_ operation: String, timeout: TimeInterval, onTimeout: @escaping () -> Void) -> Call {
+        let nanos = UInt64(max(0, timeout) * 1_000_000_000)
+        let ticks = max(1, (nanos + YellPayCompletionEngine.tickNanos - 1) / YellPayCompletionEngine.tickNanos)
+        os_unfair_lock_lock(lock)
+        nextId &+= 1
+        let id = nextId
+        let now = currentTick()
+        if pending.isEmpty {
+            // Wheel was idle; skip the empty slots instead of walking them on the next tick
+            processedTick = max(processedTick, now)
+        }
+        let deadline = now + ticks
+        pending[id] = Entry(operation: operation, startNanos: DispatchTime.now().uptimeNanoseconds, deadlineTick: deadline, onTimeout: onTimeout)
+        slots[Int(deadline % UInt64(YellPayCompletionEngine.slotCount))].append(id)
+        let needsTimer = timer == nil
+        os_unfair_lock_unlock(lock)
+
+        if needsTimer {
+            queue.async { self.startTimerIfNeeded() }
+        }
+        return Call(id: id)
+    }
+
+    fileprivate func claim(_ id: UInt64, failed: Bool?) -> Bool {
+        os_unfair_lock_lock(lock)
+        let entry = pending.removeValue(forKey: id)
+        os_unfair_lock_unlock(lock)
+        guard let claimed = entry else { return false }
+        guard let failed = failed else {
+            YellPayCircuitBreaker.shared.release(claimed.operation)
+            return true
+        }
+        let elapsedMs = Double(DispatchTime.now().uptimeNanoseconds - claimed.startNanos) / 1_000_000
+        YellPayMetrics.shared.recordLatency(claimed.operation, ms: elapsedMs)
+        if failed {
+            YellPayMetrics.shared.recordError(claimed.operation)
+        }
+        YellPayCircuitBreaker.shared.record(claimed.operation, failed: failed)
+        return true
+    }
+
+    var pendingCount: Int {
+        os_unfair_lock_lock(lock)
+        defer { os_unfair_lock_unlock(lock) }
+        return pending.count
+    }
+
+    // Runs on `queue`
+    private func startTimerIfNeeded() {
+        guard timer == nil else { return }
+        let source = DispatchSource.makeTimerSource(queue: queue)
+        let interval = DispatchTimeInterval.nanoseconds(Int(YellPayCompletionEngine.tickNanos))
+        source.schedule(deadline: .now() + interval, repeating: interval, leeway: .milliseconds(50))
+        source.setEventHandler { [weak self] in self?.advance() }
+        os_unfair_lock_lock(lock)
+        timer = source
+        os_unfair_lock_unlock(lock)
+        source.resume()
+    }
+
+    // Runs on `queue`: walks every slot passed since the last tick and fires expired calls
+    private func advance() {
+        var expired: [Entry] = []
+
+        os_unfair_lock_lock(lock)
+        let target = currentTick()
+        while processedTick < target {
+            processedTick += 1
+            let tick = processedTick
+            let index = Int(tick % UInt64(YellPayCompletionEngine.slotCount))
+            slots[index].removeAll { id in
+                guard let entry = pending[id] else { return true }
+                guard entry.deadlineTick <= tick else { return false }
+                pending.removeValue(forKey: id)
+                expired.append(entry)
+                return true
+            }
+        }
+        if pending.isEmpty {
+            // Nothing left to time out: stop ticking and drop ids of calls that already completed
+            timer?.cancel()
+            timer = nil
+            for index in slots.indices where !slots[index].isEmpty {
+                slots[index].removeAll(keepingCapacity: true)
+            }
+        }
+        os_unfair_lock_unlock(lock)
+
+        if !expired.isEmpty {
+            expired.forEach {
+                YellPayMetrics.shared.recordTimeout($0.operation)
+                YellPayCircuitBreaker.shared.record($0.operation, failed: true)
+            }
+            DispatchQueue.main.async {
+                expired.forEach { $0.onTimeout() }
+            }
+        }
+    }
+}
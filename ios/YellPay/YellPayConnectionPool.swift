@@ -0,0 +1,131 @@
+import Foundation
+
+// Keeps one long-lived URLSession per backend environment and pre-warms it
+// (DNS, TCP, TLS) before latency-sensitive SDK calls such as main card lookup
+// followed by payment. Task metrics are used to count real handshakes versus
+// reused connections so the effect can be checked from JS.
+final class YellPayConnectionPool: NSObject, URLSessionTaskDelegate {
+
+    static let shared = YellPayConnectionPool()
+
+    struct Counters {
+        var warmups = 0
+        var failures = 0
+        var handshakes = 0
+        var reusedConnections = 0
+        var lastWarmupAt: Date?
+        var lastHandshakeMs: Double?
+    }
+
+    // Do not re-warm an environment more often than this
+    static let minimumWarmupInterval: TimeInterval = 30
+
+    private let lock = NSLock()
+    private var sessions: [String: URLSession] = [:]
+    private var counters: [String: Counters] = [:]
+
+    private override init() {
+        super.init()
+    }
+
+    // Backend hosts used by each environment mode
+    static func hosts(for environment: String) -> [String] {
+        switch environment {
+        case "Production":
+            return [YellPay.authDomain, YellPay.PAYMENT_DOMAIN]
+        default:
+            return []
+        }
+    }
+
+    private func session(for environment: String) -> URLSession {
+        lock.lock()
+        defer { lock.unlock() }
+        if let existing = sessions[environment] {
+            return existing
+        }
+        let configuration = URLSessionConfiguration.default
+        configuration.httpMaximumConnectionsPerHost = 4
+        configuration.timeoutIntervalForRequest = 10
+        configuration.requestCachePolicy = .reloadIgnoringLocalCacheData
+        configuration.urlCache = nil
+        let session = URLSession(configuration: configuration, delegate: self, delegateQueue: nil)
+        sessions[environment] = session
+        return session
+    }
+
+    /// Opens (or keeps alive) connections to every host of the environment.
+    /// Returns false when the environment was warmed recently and nothing was sent.
+    @discardableResult
+    func warmUp(environment: String, force: Bool = false) -> Bool {
+        let hosts = YellPayConnectionPool.hosts(for: environment)
+        guard !hosts.isEmpty else { return false }
+
+        lock.lock()
+        let lastWarmup = counters[environment]?.lastWarmupAt
+        if !force, let last = lastWarmup, Date().timeIntervalSince(last) < YellPayConnectionPool.minimumWarmupInterval {
+            lock.unlock()
+            return false
+        }
+        counters[environment, default: Counters()].warmups += 1
+        counters[environment, default: Counters()].lastWarmupAt = Date()
+        lock.unlock()
+
+        let session = session(for: environment)
+        for host in hosts {
+            guard let url = URL(string: "https://\(host)/") else { continue }
+            var request = URLRequest(url: url)
+            request.httpMethod = "HEAD"
+            let task = session.dataTask(with: request) { [weak self] _, _, error in
+                guard error != nil, let self = self else { return }
+                self.lock.lock()
+                self.counters[environment, default: Counters()].failures += 1
+                self.lock.unlock()
+            }
+            task.taskDescription = environment
+            task.resume()
+        }
+        return true
+    }
+
+    func snapshot() -> [String: Any] {
+        lock.lock()
+        defer { lock.unlock() }
+        var result: [String: Any] = [:]
+        for (environment, value) in counters {
+            result[environment] = [
+                "warmups": value.warmups,
+                "failures": value.failures,
+                "handshakes": value.handshakes,
+                "handshakesAvoided": value.reusedConnections,
+                "lastWarmupAt": value.lastWarmupAt.map { $0.timeIntervalSince1970 * 1000 } ?? NSNull(),
+                "lastHandshakeMs": value.lastHandshakeMs ?? NSNull()
+            ]
+        }
+        return result
+    }
+
+    // MARK: - URLSessionTaskDelegate
+
+    func urlSession(_ session: URLSession, task: URLSessionTask, didFinishCollecting metrics: URLSessionTaskMetrics) {
+        guard let environment = task.taskDescription else { return }
+        lock.lock()
+        defer { lock.unlock() }
+        for transaction in metrics.transactionMetrics where transaction.resourceFetchType == .networkLoad {
+            if let requestStart = transaction.requestStartDate, let responseStart = transaction.responseStartDate {
+                YellPayMetrics.shared.recordTimeToFirstByte("warmUpConnections", ms: responseStart.timeIntervalSince(requestStart) * 1000)
+            }
+            YellPayMetrics.shared.recordBytes(
+                "warmUpConnections",
+                transaction.countOfRequestHeaderBytesSent + transaction.countOfRequestBodyBytesSent
+                    + transaction.countOfResponseHeaderBytesReceived + transaction.countOfResponseBodyBytesReceived
+            )
+            if transaction.isReusedConnection {
+                counters[environment, default: Counters()].reusedConnections += 1
+            } else if let start = transaction.secureConnectionStartDate, let end = transaction.secureConnectionEndDate {
+                counters[environment, default: Counters()].handshakes += 1
+                counters[environment, default: Counters()].lastHandshakeMs = end.timeIntervalSince(start) * 1000
+            }
+        }
+    }
+}
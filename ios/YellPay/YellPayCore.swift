@@ -0,0 +1,229 @@
+import Foundation
+
+// Platform-neutral part of the YellPay bridge.
+// Nothing in this file may import UIKit, React or RouteCode: it only deals with
+// the values going into and coming out of the SDK, so it can be compiled and
+// profiled on its own (e.g. `swiftc` on Linux) without a device.
+enum YellPayCore {
+
+    // MARK: - Input Sanitization
+
+    static let defaultAllowedCharacters: CharacterSet = {
+        var set = CharacterSet.alphanumerics
+        set.insert(charactersIn: ".-_:@")
+        return set
+    }()
+
+    // Basic input sanitization to avoid SDK crashes on unexpected strings
+    static func sanitize(_ value: String, maxLength: Int = 256, allowed: CharacterSet? = nil) -> String {
+        let trimmed = value.trimmingCharacters(in: .whitespacesAndNewlines)
+        let characterSet = allowed ?? defaultAllowedCharacters
+        let filteredScalars = trimmed.unicodeScalars.filter { characterSet.contains($0) }
+        let filtered = String(String.UnicodeScalarView(filteredScalars))
+        return String(filtered.prefix(maxLength))
+    }
+
+    // MARK: - Error Mapping
+
+    struct BridgeError {
+        let code: String
+        let message: String
+    }
+
+    enum FlowKind {
+        case cardRegister
+        case payment
+    }
+
+    // Maps SDK status codes of the UI flows to promise rejection codes.
+    // Japanese messages coming from the SDK are passed through untouched.
+    static func mapFlowError(_ flow: FlowKind, errorCode: Int, errorMessage: Any?) -> BridgeError {
+        let rawMessage = String(describing: errorMessage ?? "")
+
+        var code = flow == .cardRegister ? "CARD_REGISTER_ERROR" : "PAYMENT_ERROR"
+        var message = rawMessage
+
+        switch errorCode {
+        case -100, -101:
+            code = "AUTHENTICATION_ERROR"
+            message = flow == .cardRegister
+                ? "Authentication required. Please complete authentication and user initialization first. (\(rawMessage))"
+                : "Authentication required. Please complete authentication first. (\(rawMessage))"
+        case -200:
+            code = "INVALID_PARAMETERS"
+            message = "Invalid parameters provided. Please check your input. (\(rawMessage))"
+        case -300:
+            code = "NETWORK_ERROR"
+            message = "Network error occurred. Please check your connection and try again. (\(rawMessage))"
+        case -400:
+            code = flow == .cardRegister ? "CARD_ALREADY_REGISTERED" : "CARD_NOT_REGISTERED"
+            message = flow == .cardRegister
+                ? "Card is already registered. (\(rawMessage))"
+                : "Card not registered. Please register a card first. (\(rawMessage))"
+        case -500:
+            code = flow == .cardRegister ? "CARD_REGISTRATION_FAILED" : "PAYMENT_FAILED"
+            message = flow == .cardRegister
+                ? "Card registration failed. Please try again. (\(rawMessage))"
+                : "Payment failed. Please try again. (\(rawMessage))"
+        default:
+            break
+        }
+
+        let japaneseMarkers = flow == .cardRegister
+            ? ["登録", "失敗", "再登録", "最初から"]
+            : ["支払い", "失敗", "エラー", "登録"]
+        if japaneseMarkers.contains(where: { rawMessage.contains($0) }) {
+            message = rawMessage
+        }
+
+        return BridgeError(code: code, message: message)
+    }
+
+    // MARK: - Response Decoding
+
+    // Lenient accessors for loosely typed SDK dictionaries (NSNull, NSNumber or String)
+    static func string(_ value: Any?) -> String {
+        guard let value = value, !(value is NSNull) else { return "" }
+        if let str = value as? String { return str }
+        if let num = value as? NSNumber { return num.stringValue }
+        return ""
+    }
+
+    static func int(_ value: Any?) -> Int {
+        guard let value = value, !(value is NSNull) else { return 0 }
+        if let num = value as? Int { return num }
+        if let num = value as? NSNumber { return num.intValue }
+        if let str = value as? String { return Int(str) ?? 0 }
+        return 0
+    }
+
+    // MARK: - Typed Responses
+
+    // Each SDK payload is decoded once into a value type at the callback boundary;
+    // the bridge dictionary is produced from the struct rather than by re-walking
+    // the raw NSDictionary per field at every call site.
+
+    struct Certificate {
+        let certificateType: String
+        let status: Int
+        let additionalInfo: String
+
+        init?(_ raw: Any) {
+            guard let dict = raw as? [String: Any] else { return nil }
+            certificateType = YellPayCore.string(dict["certificateType"])
+            status = YellPayCore.int(dict["status"])
+            additionalInfo = YellPayCore.string(dict["additionalInfo"])
+        }
+
+        var bridgeValue: [String: Any] {
+            return ["certificateType": certificateType, "status": status, "additionalInfo": additionalInfo]
+        }
+    }
+
+    struct Notification {
+        let id: String
+        let title: String
+        let message: String
+        let date: String
+
+        init?(_ raw: Any) {
+            guard let dict = raw as? [String: Any] else { return nil }
+            id = YellPayCore.string(dict["notificationId"])
+            title = YellPayCore.string(dict["title"])
+            message = YellPayCore.string(dict["message"])
+            date = YellPayCore.string(dict["date"])
+        }
+
+        var bridgeValue: [String: Any] {
+            return ["id": id, "title": title, "message": message, "date": date]
+        }
+    }
+
+    struct Information {
+        let id: String
+        let title: String
+        let content: String
+        let date: String
+
+        init?(_ raw: Any) {
+            guard let dict = raw as? [String: Any] else { return nil }
+            id = YellPayCore.string(dict["informationId"])
+            title = YellPayCore.string(dict["title"])
+            content = YellPayCore.string(dict["content"])
+            date = YellPayCore.string(dict["date"])
+        }
+
+        var bridgeValue: [String: Any] {
+            return ["id": id, "title": title, "content": content, "date": date]
+        }
+    }
+
+    // ResponseGetInformationSuccessBlockType:
+    // (userInfo, alert, bannerInformation, lastUpdateNotification, notifications)
+    struct InformationResponse {
+        let userInfo: [String: Any]
+        let alert: [String: Any]
+        let banners: [Information]
+        let lastUpdate: Int
+        let notifications: [Notification]
+
+        init(userInfo: [AnyHashable: Any]?, alert: [AnyHashable: Any]?, bannerInformation: [Any]?, lastUpdate: Int, notifications: [Any]?) {
+            self.userInfo = YellPayCore.bridgeDictionary(userInfo)
+            self.alert = YellPayCore.bridgeDictionary(alert)
+            self.banners = (bannerInformation ?? []).compactMap(Information.init)
+            self.lastUpdate = lastUpdate
+            self.notifications = (notifications ?? []).compactMap(Notification.init)
+        }
+
+        var bridgeValue: [String: Any] {
+            return [
+                "userInfo": userInfo,
+                "alert": alert,
+                "information": banners.map { $0.bridgeValue },
+                "lastUpdate": lastUpdate,
+                "count": lastUpdate,
+                "notifications": notifications.map { $0.bridgeValue }
+            ]
+        }
+    }
+
+    // ResponseGetConfirmLimitAmountSuccessBlockType: (userInfo, alert)
+    struct ConfirmLimitAmountResponse {
+        let userInfo: [String: Any]
+        let alert: [String: Any]
+
+        init(userInfo: [AnyHashable: Any]?, alert: [AnyHashable: Any]?) {
+            self.userInfo = YellPayCore.bridgeDictionary(userInfo)
+            self.alert = YellPayCore.bridgeDictionary(alert)
+        }
+
+        var bridgeValue: [String: Any] {
+            return ["userInfo": userInfo, "alert": alert]
+        }
+    }
+
+    // Keeps only string keys so the payload survives the bridge
+    static func bridgeDictionary(_ raw: [AnyHashable: Any]?) -> [String: Any] {
+        guard let raw = raw else { return [:] }
+        var result: [String: Any] = [:]
+        result.reserveCapacity(raw.count)
+        for (key, value) in raw {
+            if let key = key as? String {
+                result[key] = value
+            }
+        }
+        return result
+    }
+
+    static func certificates(from userCertificates: [Any]?) -> [[String: Any]] {
+        return (userCertificates ?? []).compactMap(Certificate.init).map { $0.bridgeValue }
+    }
+
+    static func notifications(from notificationList: [Any]?) -> [[String: Any]] {
+        return (notificationList ?? []).compactMap(Notification.init).map { $0.bridgeValue }
+    }
+
+    static func information(from informationList: [Any]?) -> [[String: Any]] {
+        return (informationList ?? []).compactMap(Information.init).map { $0.bridgeValue }
+    }
+}
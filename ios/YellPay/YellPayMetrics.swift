@@ -0,0 +1,135 @@
+import Foundation
+
+// In-process instrumentation for bridge calls. Latencies go into fixed log-scale
+// histograms (no per-sample storage), so recording is O(1) and a snapshot for JS
+// reports p50/p95/p99 per method along with error, timeout and circuit-breaker
+// counts. Percentiles are the upper bound of the bucket holding that rank.
+final class YellPayMetrics {
+
+    static let shared = YellPayMetrics()
+
+    // Bucket upper bounds in milliseconds; the last bucket is open-ended
+    static let bucketBoundsMs: [Double] = [1, 2, 5, 10, 20, 50, 100, 200, 500, 1_000, 2_000, 5_000, 10_000, 20_000, 30_000, 60_000]
+
+    struct Histogram {
+        var buckets = [Int](repeating: 0, count: YellPayMetrics.bucketBoundsMs.count + 1)
+        var count = 0
+        var sumMs: Double = 0
+        var maxMs: Double = 0
+
+        mutating func record(_ ms: Double) {
+            let index = YellPayMetrics.bucketBoundsMs.firstIndex { ms <= $0 } ?? YellPayMetrics.bucketBoundsMs.count
+            buckets[index] += 1
+            count += 1
+            sumMs += ms
+            maxMs = max(maxMs, ms)
+        }
+
+        func percentile(_ p: Double) -> Double {
+            guard count > 0 else { return 0 }
+            let rank = Int((Double(count) * p).rounded(.up))
+            var seen = 0
+            for (index, bucketCount) in buckets.enumerated() {
+                seen += bucketCount
+                if seen >= rank {
+                    return index < YellPayMetrics.bucketBoundsMs.count ? YellPayMetrics.bucketBoundsMs[index] : maxMs
+                }
+            }
+            return maxMs
+        }
+
+        var bridgeValue: [String: Any] {
+            return [
+                "count": count,
+                "p50": percentile(0.50),
+                "p95": percentile(0.95),
+                "p99": percentile(0.99),
+                "max": maxMs,
+                "mean": count > 0 ? sumMs / Double(count) : 0
+            ]
+        }
+    }
+
+    struct MethodStats {
+        var latency = Histogram()
+        var decode = Histogram()
+        var ttfb = Histogram()
+        var errors = 0
+        var timeouts = 0
+        var bytes: Int64 = 0
+    }
+
+    private let lock = NSLock()
+    private var methods: [String: MethodStats] = [:]
+    private var transitions: [[String: Any]] = []
+    private static let maxTransitions = 50
+
+    private init() {}
+
+    private func update(_ method: String, _ body: (inout MethodStats) -> Void) {
+        lock.lock()
+        defer { lock.unlock() }
+        body(&methods[method, default: MethodStats()])
+    }
+
+    func recordLatency(_ method: String, ms: Double) {
+        update(method) { $0.latency.record(ms) }
+    }
+
+    func recordDecode(_ method: String, ms: Double) {
+        update(method) { $0.decode.record(ms) }
+    }
+
+    func recordTimeToFirstByte(_ method: String, ms: Double) {
+        update(method) { $0.ttfb.record(ms) }
+    }
+
+    func recordBytes(_ method: String, _ bytes: Int64) {
+        update(method) { $0.bytes += bytes }
+    }
+
+    func recordError(_ method: String) {
+        update(method) { $0.errors += 1 }
+    }
+
+    func recordTimeout(_ method: String) {
+        update(method) { $0.timeouts += 1 }
+    }
+
+    func recordBreakerTransition(_ method: String, to state: String) {
+        lock.lock()
+        defer { lock.unlock() }
+        transitions.append([
+            "method": method,
+            "state": state,
+            "at": Date().timeIntervalSince1970 * 1000
+        ])
+        if transitions.count > YellPayMetrics.maxTransitions {
+            transitions.removeFirst(transitions.count - YellPayMetrics.maxTransitions)
+        }
+    }
+
+    func snapshot() -> [String: Any] {
+        lock.lock()
+        defer { lock.unlock() }
+        var result: [String: Any] = [:]
+        for (method, stats) in methods {
+            result[method] = [
+                "latencyMs": stats.latency.bridgeValue,
+                "decodeMs": stats.decode.bridgeValue,
+                "ttfbMs": stats.ttfb.bridgeValue,
+                "errors": stats.errors,
+                "timeouts": stats.timeouts,
+                "bytes": stats.bytes
+            ]
+        }
+        return ["methods": result, "breakerTransitions": transitions]
+    }
+
+    func reset() {
+        lock.lock()
+        defer { lock.unlock() }
+        methods.removeAll()
+        transitions.removeAll()
+    }
+}
@@ -17,6 +17,17 @@
 RCT_EXTERN_METHOD(getProductionConfig:(RCTPromiseResolveBlock)resolve
                   rejecter:(RCTPromiseRejectBlock)reject)
 
+RCT_EXTERN_METHOD(setAuthDomainOverride:(NSString *)domain
+                  resolver:(RCTPromiseResolveBlock)resolve
+                  rejecter:(RCTPromiseRejectBlock)reject)
+
+// MARK: - Connection Methods
+RCT_EXTERN_METHOD(warmUpConnections:(RCTPromiseResolveBlock)resolve
+                  rejecter:(RCTPromiseRejectBlock)reject)
+
+RCT_EXTERN_METHOD(getConnectionStats:(RCTPromiseResolveBlock)resolve
+                  rejecter:(RCTPromiseRejectBlock)reject)
+
 // MARK: - Authentication Methods
 RCT_EXTERN_METHOD(authRegister:(NSString *)domainName
                   resolver:(RCTPromiseResolveBlock)resolve
@@ -89,6 +100,27 @@ RCT_EXTERN_METHOD(paymentForQR:(NSString *)uuid
                   resolver:(RCTPromiseResolveBlock)resolve
                   rejecter:(RCTPromiseRejectBlock)reject)
 
+RCT_EXTERN_METHOD(paymentScheme:(NSString *)uuid
+                  userNo:(nonnull NSNumber *)userNo
+                  payUserId:(NSString *)payUserId
+                  streamSeed:(NSString *)streamSeed
+                  streamTime:(nonnull NSNumber *)streamTime
+                  resolver:(RCTPromiseResolveBlock)resolve
+                  rejecter:(RCTPromiseRejectBlock)reject)
+
+RCT_EXTERN_METHOD(addStreamTokens:(NSArray *)tokens
+                  resolver:(RCTPromiseResolveBlock)resolve
+                  rejecter:(RCTPromiseRejectBlock)reject)
+
+RCT_EXTERN_METHOD(configureStreamTokenPool:(nonnull NSNumber *)capacity
+                  maxAgeMs:(nonnull NSNumber *)maxAgeMs
+                  resolver:(RCTPromiseResolveBlock)resolve
+                  rejecter:(RCTPromiseRejectBlock)reject)
+
+RCT_EXTERN_METHOD(cancelFlow:(NSString *)flow
+                  resolver:(RCTPromiseResolveBlock)resolve
+                  rejecter:(RCTPromiseRejectBlock)reject)
+
 RCT_EXTERN_METHOD(getHistory:(NSString *)userId
                   resolver:(RCTPromiseResolveBlock)resolve
                   rejecter:(RCTPromiseRejectBlock)reject)
@@ -97,7 +129,20 @@ RCT_EXTERN_METHOD(cardSelect:(nonnull NSNumber *)userNo
                   resolver:(RCTPromiseResolveBlock)resolve
                   rejecter:(RCTPromiseRejectBlock)reject)
 
-RCT_EXTERN_METHOD(getMainCreditCard:(RCTPromiseResolveBlock)resolve
+RCT_EXTERN_METHOD(getMainCreditCard:(NSString *)payUserId
+                  resolver:(RCTPromiseResolveBlock)resolve
+                  rejecter:(RCTPromiseRejectBlock)reject)
+
+RCT_EXTERN_METHOD(setMainCard:(NSString *)uuid
+                  userNo:(nonnull NSNumber *)userNo
+                  resolver:(RCTPromiseResolveBlock)resolve
+                  rejecter:(RCTPromiseRejectBlock)reject)
+
+RCT_EXTERN_METHOD(preparePayment:(NSString *)payUserId
+                  resolver:(RCTPromiseResolveBlock)resolve
+                  rejecter:(RCTPromiseRejectBlock)reject)
+
+RCT_EXTERN_METHOD(clearMainCardCache:(RCTPromiseResolveBlock)resolve
                   rejecter:(RCTPromiseRejectBlock)reject)
 
 RCT_EXTERN_METHOD(getUserInfo:(NSString *)userId
@@ -108,14 +153,61 @@ RCT_EXTERN_METHOD(viewCertificate:(NSString *)userId
                   resolver:(RCTPromiseResolveBlock)resolve
                   rejecter:(RCTPromiseRejectBlock)reject)
 
-RCT_EXTERN_METHOD(getNotification:(nonnull NSNumber *)count
+RCT_EXTERN_METHOD(getNotification:(NSString *)userId
+                  lastUpdate:(nonnull NSNumber *)lastUpdate
+                  resolver:(RCTPromiseResolveBlock)resolve
+                  rejecter:(RCTPromiseRejectBlock)reject)
+
+RCT_EXTERN_METHOD(syncNotifications:(NSString *)userId
+                  resolver:(RCTPromiseResolveBlock)resolve
+                  rejecter:(RCTPromiseRejectBlock)reject)
+
+RCT_EXTERN_METHOD(getStoredNotifications:(NSString *)userId
+                  offset:(nonnull NSNumber *)offset
+                  limit:(nonnull NSNumber *)limit
+                  resolver:(RCTPromiseResolveBlock)resolve
+                  rejecter:(RCTPromiseRejectBlock)reject)
+
+RCT_EXTERN_METHOD(queryStoredNotifications:(NSString *)userId
+                  query:(NSDictionary *)query
+                  resolver:(RCTPromiseResolveBlock)resolve
+                  rejecter:(RCTPromiseRejectBlock)reject)
+
+RCT_EXTERN_METHOD(getInformation:(NSString *)userId
+                  infoType:(nonnull NSNumber *)infoType
+                  resolver:(RCTPromiseResolveBlock)resolve
+                  rejecter:(RCTPromiseRejectBlock)reject)
+
+RCT_EXTERN_METHOD(getConfirmLimitAmount:(NSString *)userId
+                  resolver:(RCTPromiseResolveBlock)resolve
+                  rejecter:(RCTPromiseRejectBlock)reject)
+
+// MARK: - Cancellable Request Methods
+RCT_EXTERN_METHOD(request:(NSString *)method
+                  userId:(NSString *)userId
+                  lastUpdate:(nonnull NSNumber *)lastUpdate
+                  requestId:(NSString *)requestId
+                  resolver:(RCTPromiseResolveBlock)resolve
+                  rejecter:(RCTPromiseRejectBlock)reject)
+
+RCT_EXTERN_METHOD(cancelRequest:(NSString *)requestId
                   resolver:(RCTPromiseResolveBlock)resolve
                   rejecter:(RCTPromiseRejectBlock)reject)
 
-RCT_EXTERN_METHOD(getInformation:(nonnull NSNumber *)infoType
+// MARK: - Batch Methods
+RCT_EXTERN_METHOD(batch:(NSArray *)operations
                   resolver:(RCTPromiseResolveBlock)resolve
                   rejecter:(RCTPromiseRejectBlock)reject)
 
+// MARK: - Card Image Methods
+RCT_EXTERN_METHOD(renderCardImages:(NSArray *)cards
+                  scale:(nonnull NSNumber *)scale
+                  resolver:(RCTPromiseResolveBlock)resolve
+                  rejecter:(RCTPromiseRejectBlock)reject)
+
+RCT_EXTERN_METHOD(clearCardImageCache:(RCTPromiseResolveBlock)resolve
+                  rejecter:(RCTPromiseRejectBlock)reject)
+
 // MARK: - Debug Methods
 RCT_EXTERN_METHOD(checkFrameworkAvailability:(RCTPromiseResolveBlock)resolve
                   rejecter:(RCTPromiseRejectBlock)reject)
@@ -129,4 +221,15 @@ RCT_EXTERN_METHOD(resetCrashProtection:(RCTPromiseResolveBlock)resolve
 RCT_EXTERN_METHOD(getCrashProtectionStatus:(RCTPromiseResolveBlock)resolve
                   rejecter:(RCTPromiseRejectBlock)reject)
 
+RCT_EXTERN_METHOD(configureCircuitBreaker:(NSDictionary *)spec
+                  resolver:(RCTPromiseResolveBlock)resolve
+                  rejecter:(RCTPromiseRejectBlock)reject)
+
+// MARK: - Metrics Methods
+RCT_EXTERN_METHOD(getMetricsSnapshot:(RCTPromiseResolveBlock)resolve
+                  rejecter:(RCTPromiseRejectBlock)reject)
+
+RCT_EXTERN_METHOD(resetMetrics:(RCTPromiseResolveBlock)resolve
+                  rejecter:(RCTPromiseRejectBlock)reject)
+
 @end
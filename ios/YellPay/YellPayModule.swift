@@ -88,9 +88,9 @@ public class YellPayBridge: RCTEventEmitter {
         YellPay.sharedInstance.cardSelect(userId, resolver: resolve, rejecter: reject)
     }
     
-    @objc(getMainCreditCard:rejecter:)
-    func getMainCreditCard(_ resolve: @escaping RCTPromiseResolveBlock, rejecter reject: @escaping RCTPromiseRejectBlock) {
-        YellPay.sharedInstance.getMainCreditCard(resolve, rejecter: reject)
+    @objc(getMainCreditCard:resolver:rejecter:)
+    func getMainCreditCard(_ payUserId: String, resolver resolve: @escaping RCTPromiseResolveBlock, rejecter reject: @escaping RCTPromiseRejectBlock) {
+        YellPay.sharedInstance.getMainCreditCard(payUserId, resolver: resolve, rejecter: reject)
     }
     
     @objc(getHistory:resolver:rejecter:)
@@ -128,46 +128,63 @@ class YellPay: NSObject {
         super.init()
     }
     
-    // Circuit breaker for crash protection
-    private static var crashedOperations: Set<String> = []
-    private static var operationAttempts: [String: Int] = [:]
-    private static let maxAttempts = 3
-    
     @objc
     static func requiresMainQueueSetup() -> Bool {
         return true
     }
     
-    // Circuit breaker implementation
-    private func isOperationBlocked(_ operationName: String) -> Bool {
-        return YellPay.crashedOperations.contains(operationName)
+    // Basic input sanitization to avoid SDK crashes on unexpected strings
+    private func sanitize(_ value: String, maxLength: Int = 256, allowed: CharacterSet? = nil) -> String {
+        return YellPayCore.sanitize(value, maxLength: maxLength, allowed: allowed)
     }
-    
-    private func incrementAttempt(_ operationName: String) {
-        YellPay.operationAttempts[operationName] = (YellPay.operationAttempts[operationName] ?? 0) + 1
+
+    // SDK may call back from a background thread - hop to main only when needed
+    private func runOnMain(_ block: @escaping () -> Void) {
+        if Thread.isMainThread {
+            block()
+        } else {
+            DispatchQueue.main.async(execute: block)
+        }
     }
     
-    private func blockOperation(_ operationName: String) {
-        YellPay.crashedOperations.insert(operationName)
-        print("💥 Operation \(operationName) blocked due to repeated failures")
+    // MARK: - Execution Queues
+    
+    // RoutePay calls that present no UI and are safe to issue off the main thread.
+    // Interactive auth, card and payment flows stay on main.
+    static let uiFreeOperations: Set<String> = ["getUserInfo", "getNotification", "getInformation", "getConfirmLimitAmount"]
+    
+    static let sdkQueue = DispatchQueue(label: "com.yellpay.sdk", qos: .userInitiated, attributes: .concurrent)
+    
+    // RouteAuth auto-auth calls take no view controller but do key generation, signing
+    // and base64 work synchronously before their first request. They get a serial queue
+    // of their own so that work never blocks main and two calls never race on the stored key.
+    static let authOperations: Set<String> = ["autoAuthRegister", "autoAuthApproval"]
+    
+    static let authQueue = DispatchQueue(label: "com.yellpay.auth", qos: .userInitiated)
+    
+    static func executionQueue(for operationKey: String) -> DispatchQueue {
+        if authOperations.contains(operationKey) {
+            return authQueue
+        }
+        return uiFreeOperations.contains(operationKey) ? sdkQueue : DispatchQueue.main
     }
     
-    private func shouldBlockOperation(_ operationName: String) -> Bool {
-        let attempts = YellPay.operationAttempts[operationName] ?? 0
-        return attempts >= YellPay.maxAttempts
+    // Auth calls have no completion-engine timeout (the SDK owns retries), so time them directly
+    static func recordAuthLatency(_ operationKey: String, since start: UInt64) {
+        YellPayMetrics.shared.recordLatency(operationKey, ms: Double(DispatchTime.now().uptimeNanoseconds - start) / 1_000_000)
     }
     
-    // Basic input sanitization to avoid SDK crashes on unexpected strings
-    private func sanitize(_ value: String, maxLength: Int = 256, allowed: CharacterSet? = nil) -> String {
-        let trimmed = value.trimmingCharacters(in: .whitespacesAndNewlines)
-        let characterSet = allowed ?? {
-            var set = CharacterSet.alphanumerics
-            set.insert(charactersIn: ".-_:@")
-            return set
-        }()
-        let filteredScalars = trimmed.unicodeScalars.filter { characterSet.contains($0) }
-        let filtered = String(String.UnicodeScalarView(filteredScalars))
-        return String(filtered.prefix(maxLength))
+    // Decode an SDK payload on the SDK queue, then finish on main where the
+    // per-call completion flag and circuit breaker state live
+    private func decodeThenComplete<T>(_ operationKey: String, _ decode: @escaping () -> T, _ complete: @escaping (T) -> Void) {
+        YellPay.sdkQueue.async {
+            let start = DispatchTime.now().uptimeNanoseconds
+            let value = autoreleasepool(invoking: decode)
+            YellPayMetrics.shared.recordDecode(operationKey, ms: Double(DispatchTime.now().uptimeNanoseconds - start) / 1_000_000)
+            DispatchQueue.main.async {
+                complete(value)
+            }
+        }
     }
     
     // For new React Native architecture compatibility
@@ -180,7 +197,7 @@ class YellPay: NSObject {
         ]
     }
     
-    // Ensure methods are properly queued on main thread
+    // Bridge entry points run on main; UI-free SDK calls move to sdkQueue themselves
     @objc
     static func methodQueue() -> DispatchQueue {
         return DispatchQueue.main
@@ -191,12 +208,17 @@ class YellPay: NSObject {
     static let PAYMENT_DOMAIN = "dev-pay.unid.net"
     static let SERVICE_ID = "yellpay"
     
+    // Debug builds may point RouteAuth at a local mock (server/routecodeMock.js).
+    // RoutePay picks its payment host from EnvironmentModeEnum internally, so only auth can be redirected.
+    static var authDomainOverride: String?
+    static var authDomain: String { return authDomainOverride ?? AUTH_DOMAIN }
+    
     // MARK: - Configuration Methods
     
     @objc
     func getProductionConfig(_ resolve: @escaping RCTPromiseResolveBlock, rejecter reject: @escaping RCTPromiseRejectBlock) {
         let config: [String: Any] = [
-            "authDomain": YellPay.AUTH_DOMAIN,
+            "authDomain": YellPay.authDomain,
             "paymentDomain": YellPay.PAYMENT_DOMAIN,
             "serviceId": YellPay.SERVICE_ID,
             "environmentMode": "Production"
@@ -204,10 +226,42 @@ class YellPay: NSObject {
         resolve(config)
     }
     
+    @objc
+    func setAuthDomainOverride(_ domain: String, resolver resolve: @escaping RCTPromiseResolveBlock, rejecter reject: @escaping RCTPromiseRejectBlock) {
+        #if DEBUG
+        let allowed = CharacterSet.alphanumerics.union(CharacterSet(charactersIn: ".-:"))
+        let safeDomain = sanitize(domain, maxLength: 128, allowed: allowed)
+        YellPay.authDomainOverride = safeDomain.isEmpty ? nil : safeDomain
+        print("🧪 YellPay - Auth domain: \(YellPay.authDomain)")
+        resolve(["authDomain": YellPay.authDomain, "overridden": YellPay.authDomainOverride != nil])
+        #else
+        reject("UNSUPPORTED", "Auth domain override is only available in debug builds", nil)
+        #endif
+    }
+    
+    // MARK: - Connection Methods
+    
+    @objc
+    func warmUpConnections(_ resolve: @escaping RCTPromiseResolveBlock, rejecter reject: @escaping RCTPromiseRejectBlock) {
+        let started = YellPayConnectionPool.shared.warmUp(environment: "Production")
+        resolve([
+            "environmentMode": "Production",
+            "started": started
+        ])
+    }
+    
+    @objc
+    func getConnectionStats(_ resolve: @escaping RCTPromiseResolveBlock, rejecter reject: @escaping RCTPromiseRejectBlock) {
+        resolve(YellPayConnectionPool.shared.snapshot())
+    }
+    
     // MARK: - Authentication Methods
     
     @objc
     func authRegister(_ domainName: String, resolver resolve: @escaping RCTPromiseResolveBlock, rejecter reject: @escaping RCTPromiseRejectBlock) {
+        // Authentication may switch users, so the cached main card is dropped
+        invalidateMainCard()
+        
         print("🔥 YellPay.authRegister START - domainName: \(domainName)")
         
         let safeDomain = sanitize(domainName, maxLength: 128)
@@ -227,28 +281,18 @@ class YellPay: NSObject {
             
             print("✅ YellPay.authRegister - Got view controller, calling RouteAuth.callRegister")
             
-            // Add timeout handling with proper cleanup
-            let timeoutTimer = DispatchSource.makeTimerSource(queue: DispatchQueue.main)
-            var isCompleted = false
-            
-            timeoutTimer.schedule(deadline: .now() + 60) // Increased timeout for user interaction
-            timeoutTimer.setEventHandler {
-                guard !isCompleted else { return }
-                isCompleted = true
-                timeoutTimer.cancel()
+            // Increased timeout for user interaction
+            let call = YellPayCompletionEngine.shared.begin("authRegister", timeout: 60) {
                 print("⏰ YellPay.authRegister - Operation timed out")
                 reject("AUTH_REGISTER_ERROR", "Authentication registration timed out. Please try again.", nil)
             }
-            timeoutTimer.resume()
             
             do {
                 RouteAuth.callRegister(
                     viewController,
                     domainName: safeDomain,
                     callSuccess: { status in
-                        guard !isCompleted else { return }
-                        isCompleted = true
-                        timeoutTimer.cancel()
+                        guard call.complete() else { return }
                         print("✅ YellPay.authRegister - Success: status=\(status)")
                         resolve([
                             "status": status,
@@ -256,9 +300,7 @@ class YellPay: NSObject {
                         ])
                     },
                     callFailed: { status, error in
-                        guard !isCompleted else { return }
-                        isCompleted = true
-                        timeoutTimer.cancel()
+                        guard self.claimFailure(call, error) else { return }
                         let errorMsg = error?.localizedDescription ?? "Unknown error"
                         print("❌ YellPay.authRegister - Failed: status=\(status), error=\(errorMsg)")
                         
@@ -271,9 +313,7 @@ class YellPay: NSObject {
                     }
                 )
             } catch {
-                guard !isCompleted else { return }
-                isCompleted = true
-                timeoutTimer.cancel()
+                guard call.fail() else { return }
                 print("💥 YellPay.authRegister - Exception: \(error)")
                 reject("AUTH_REGISTER_ERROR", "Failed to start authentication registration: \(error.localizedDescription)", error)
             }
@@ -282,6 +322,9 @@ class YellPay: NSObject {
     
     @objc
     func authApproval(_ domainName: String, resolver resolve: @escaping RCTPromiseResolveBlock, rejecter reject: @escaping RCTPromiseRejectBlock) {
+        // Authentication may switch users, so the cached main card is dropped
+        invalidateMainCard()
+        
         print("🔥 YellPay.authApproval START - domainName: \(domainName)")
         
         let safeDomain = sanitize(domainName, maxLength: 128)
@@ -301,11 +344,18 @@ class YellPay: NSObject {
             
             print("✅ YellPay.authApproval - Got view controller, calling RouteAuth.callApprovalViewController")
             
+            // Increased timeout for user interaction
+            let call = YellPayCompletionEngine.shared.begin("authApproval", timeout: 60) {
+                print("⏰ YellPay.authApproval - Operation timed out")
+                reject("AUTH_APPROVAL_ERROR", "Authentication approval timed out. Please try again.", nil)
+            }
+            
             do {
                 RouteAuth.callApprovalViewController(
                     viewController,
                     domainName: safeDomain,
                     callSuccess: { status in
+                        guard call.complete() else { return }
                         print("✅ YellPay.authApproval - Success: status=\(status)")
                         resolve([
                             "status": status,
@@ -313,6 +363,7 @@ class YellPay: NSObject {
                         ])
                     },
                     callFailed: { status, error in
+                        guard self.claimFailure(call, error) else { return }
                         let errorMsg = error?.localizedDescription ?? "Unknown error"
                         print("❌ YellPay.authApproval - Failed: status=\(status), error=\(errorMsg)")
                         
@@ -327,6 +378,7 @@ class YellPay: NSObject {
                     }
                 )
             } catch {
+                guard call.fail() else { return }
                 print("💥 YellPay.authApproval - Exception: \(error)")
                 reject("AUTH_APPROVAL_ERROR", "Failed to start authentication approval: \(error.localizedDescription)", error)
             }
@@ -335,6 +387,9 @@ class YellPay: NSObject {
     
     @objc
     func authApprovalWithMode(_ domainName: String, isQrStart: Bool, resolver resolve: @escaping RCTPromiseResolveBlock, rejecter reject: @escaping RCTPromiseRejectBlock) {
+        // Authentication may switch users, so the cached main card is dropped
+        invalidateMainCard()
+        
         DispatchQueue.main.async {
             guard let viewController = self.getCurrentViewController() else {
                 reject("AUTH_APPROVAL_ERROR", "No view controller available", nil)
@@ -347,14 +402,20 @@ class YellPay: NSObject {
                 return
             }
 
+            let call = YellPayCompletionEngine.shared.begin("authApprovalWithMode", timeout: 60) {
+                reject("AUTH_APPROVAL_ERROR", "Authentication approval timed out. Please try again.", nil)
+            }
+
             // Fallback to regular approval (SDK may not support isQrStart on iOS)
             RouteAuth.callApprovalViewController(
                 viewController,
                 domainName: safeDomain,
                 callSuccess: { status in
+                    guard call.complete() else { return }
                     resolve(["status": status])
                 },
                 callFailed: { status, error in
+                    guard call.fail() else { return }
                     reject("AUTH_APPROVAL_ERROR", "Error \(status): \(error?.localizedDescription ?? "Unknown error")", error)
                 }
             )
@@ -374,6 +435,10 @@ class YellPay: NSObject {
             let safeWaiting = self.sanitize(waitingId)
             let urlTypeInt = Int(self.sanitize(urlType, allowed: .decimalDigits)) ?? 0
 
+            let call = YellPayCompletionEngine.shared.begin("authUrlScheme", timeout: 60) {
+                reject("AUTH_URL_SCHEME_ERROR", "URL scheme authentication timed out", nil)
+            }
+
             RouteAuth.callUrlSchemeUrlType(
                 urlTypeInt,
                 providerId: safeProvider,
@@ -381,9 +446,11 @@ class YellPay: NSObject {
                 viewController: viewController,
                 domainName: safeDomain,
                 callSuccess: { status in
+                    guard call.complete() else { return }
                     resolve(["status": status])
                 },
                 callFailed: { status, error in
+                    guard call.fail() else { return }
                     let message = error?.localizedDescription ?? "Unknown error"
                     reject("AUTH_URL_SCHEME_ERROR", "Error \(status): \(message)", error)
                 }
@@ -393,7 +460,11 @@ class YellPay: NSObject {
     
     @objc
     func autoAuthRegister(_ serviceId: String, userInfo: String, domainName: String, resolver resolve: @escaping RCTPromiseResolveBlock, rejecter reject: @escaping RCTPromiseRejectBlock) {
-        DispatchQueue.main.async {
+        // Authentication may switch users, so the cached main card is dropped
+        invalidateMainCard()
+        
+        let operationKey = "autoAuthRegister"
+        YellPay.executionQueue(for: operationKey).async {
             let safeServiceId = self.sanitize(serviceId)
             let safeUserInfo = self.sanitize(userInfo)
             let safeDomain = self.sanitize(domainName, maxLength: 128)
@@ -401,14 +472,18 @@ class YellPay: NSObject {
                 reject("AUTO_AUTH_REGISTER_ERROR", "ServiceId and domainName are required", nil)
                 return
             }
+            let start = DispatchTime.now().uptimeNanoseconds
             RouteAuth.callAutoAuthRegisterDomainName(
                 safeDomain,
                 serviceId: safeServiceId,
                 userInfo: safeUserInfo,
                 callSuccess: { status in
+                    YellPay.recordAuthLatency(operationKey, since: start)
                     resolve(["status": status])
                 },
                 callFailed: { status, error in
+                    YellPay.recordAuthLatency(operationKey, since: start)
+                    YellPayMetrics.shared.recordError(operationKey)
                     reject("AUTO_AUTH_REGISTER_ERROR", "Error \(status): \(error?.localizedDescription ?? "Unknown error")", error)
                 }
             )
@@ -417,23 +492,31 @@ class YellPay: NSObject {
     
     @objc
     func autoAuthApproval(_ serviceId: String, domainName: String, resolver resolve: @escaping RCTPromiseResolveBlock, rejecter reject: @escaping RCTPromiseRejectBlock) {
-        DispatchQueue.main.async {
+        // Authentication may switch users, so the cached main card is dropped
+        invalidateMainCard()
+        
+        let operationKey = "autoAuthApproval"
+        YellPay.executionQueue(for: operationKey).async {
             let safeServiceId = self.sanitize(serviceId)
             let safeDomain = self.sanitize(domainName, maxLength: 128)
             guard !safeServiceId.isEmpty, !safeDomain.isEmpty else {
                 reject("AUTO_AUTH_APPROVAL_ERROR", "ServiceId and domainName are required", nil)
                 return
             }
+            let start = DispatchTime.now().uptimeNanoseconds
             RouteAuth.callAutoAuthApprovalDomainName(
                 safeDomain,
                 serviceId: safeServiceId,
                 callSuccess: { status, userInfo in
+                    YellPay.recordAuthLatency(operationKey, since: start)
                     resolve([
                         "status": status,
                         "userInfo": userInfo
                     ])
                 },
                 callFailed: { status, error in
+                    YellPay.recordAuthLatency(operationKey, since: start)
+                    YellPayMetrics.shared.recordError(operationKey)
                     // Improve error for missing auth key
                     let message = (error?.localizedDescription ?? "Unknown error")
                     if message.lowercased().contains("missing") || message.lowercased().contains("登録") {
@@ -450,28 +533,31 @@ class YellPay: NSObject {
     
     @objc
     func authRegisterProduction(_ resolve: @escaping RCTPromiseResolveBlock, rejecter reject: @escaping RCTPromiseRejectBlock) {
-        authRegister(YellPay.AUTH_DOMAIN, resolver: resolve, rejecter: reject)
+        authRegister(YellPay.authDomain, resolver: resolve, rejecter: reject)
     }
     
     @objc
     func authApprovalProduction(_ resolve: @escaping RCTPromiseResolveBlock, rejecter reject: @escaping RCTPromiseRejectBlock) {
-        authApproval(YellPay.AUTH_DOMAIN, resolver: resolve, rejecter: reject)
+        authApproval(YellPay.authDomain, resolver: resolve, rejecter: reject)
     }
     
     @objc
     func autoAuthRegisterProduction(_ userInfo: String, resolver resolve: @escaping RCTPromiseResolveBlock, rejecter reject: @escaping RCTPromiseRejectBlock) {
-        autoAuthRegister(YellPay.SERVICE_ID, userInfo: userInfo, domainName: YellPay.AUTH_DOMAIN, resolver: resolve, rejecter: reject)
+        autoAuthRegister(YellPay.SERVICE_ID, userInfo: userInfo, domainName: YellPay.authDomain, resolver: resolve, rejecter: reject)
     }
     
     @objc
     func autoAuthApprovalProduction(_ resolve: @escaping RCTPromiseResolveBlock, rejecter reject: @escaping RCTPromiseRejectBlock) {
-        autoAuthApproval(YellPay.SERVICE_ID, domainName: YellPay.AUTH_DOMAIN, resolver: resolve, rejecter: reject)
+        autoAuthApproval(YellPay.SERVICE_ID, domainName: YellPay.authDomain, resolver: resolve, rejecter: reject)
     }
     
     // MARK: - Payment Methods
     
     @objc
     func initUser(_ serviceId: String, resolver resolve: @escaping RCTPromiseResolveBlock, rejecter reject: @escaping RCTPromiseRejectBlock) {
+        // Authentication may switch users, so the cached main card is dropped
+        invalidateMainCard()
+        
         print("🔥 YellPay.initUser START - serviceId: \(serviceId)")
         
         // Validate input
@@ -497,6 +583,11 @@ class YellPay: NSObject {
             
             print("✅ YellPay.initUser - Got view controller, calling RoutePay.callInitialUserIdServiceId")
             
+            let call = YellPayCompletionEngine.shared.begin("initUser", timeout: 30) {
+                print("⏰ YellPay.initUser - Operation timed out")
+                reject("INIT_ERROR", "User initialization timed out. Please try again.", nil)
+            }
+            
             // Use autoreleasepool to manage memory
             autoreleasepool {
                 do {
@@ -510,14 +601,16 @@ class YellPay: NSObject {
                             
                             // Validate the returned userId
                             guard let userIdString = userId as? String, !userIdString.isEmpty else {
+                                guard call.fail() else { return }
                                 reject("INIT_ERROR", "Invalid userId returned from SDK", nil)
                                 return
                             }
                             
+                            guard call.complete() else { return }
                             resolve(userIdString)
                         },
                         callFailed: { [weak self] errorCode, errorMessage in
-                            guard self != nil else { return }
+                            guard self != nil, call.fail() else { return }
                             let errorMsg = "Init failed - Code: \(errorCode), Message: \(errorMessage)"
                             print("❌ YellPay.initUser - \(errorMsg)")
                             
@@ -530,6 +623,7 @@ class YellPay: NSObject {
                         }
                     )
                 } catch {
+                    guard call.fail() else { return }
                     print("💥 YellPay.initUser - Exception: \(error)")
                     reject("INIT_ERROR", "SDK call failed: \(error.localizedDescription)", error)
                 }
@@ -569,15 +663,13 @@ class YellPay: NSObject {
             print("✅ YellPay.registerCard - Got view controller, calling RoutePay.callCardRegisterUuid")
             
             // Add timeout protection
-            var isCompleted = false
-            let timeoutWorkItem = DispatchWorkItem { [weak self] in
-                guard !isCompleted, let self = self else { return }
-                isCompleted = true
+            let call = YellPayCompletionEngine.shared.begin("registerCard", timeout: 30) { [weak self] in
+                guard let self = self else { return }
                 print("⏰ YellPay.registerCard - Operation timed out")
+                self.tearDownFlow("registerCard")
                 reject("REGISTER_TIMEOUT", "Card registration timed out. Please try again.", nil)
             }
-            
-            DispatchQueue.main.asyncAfter(deadline: .now() + 30, execute: timeoutWorkItem)
+            self.trackFlow("registerCard", call: call, host: viewController, reject: reject)
             
             do {
                 // Verify we're on main thread before SDK call
@@ -591,117 +683,32 @@ class YellPay: NSObject {
                     viewController: viewController,
                     environmentMode: EnvironmentModeEnum.production,
                     callSuccess: { uuid, userNo in
-                        // SDK may call from background thread - ensure we're on main thread
-                        if Thread.isMainThread {
-                            guard !isCompleted else { return }
-                            isCompleted = true
-                            timeoutWorkItem.cancel()
+                        self.runOnMain {
+                            guard call.complete() else { return }
+                            self.finishFlow("registerCard", call: call)
                             print("✅ YellPay.registerCard - Success: uuid=\(String(describing: uuid)), userNo=\(userNo)")
+                            self.invalidateMainCard()
                             resolve([
                                 "uuid": uuid ?? "",
                                 "userNo": userNo
                             ])
-                        } else {
-                            DispatchQueue.main.async {
-                                guard !isCompleted else { return }
-                                isCompleted = true
-                                timeoutWorkItem.cancel()
-                                print("✅ YellPay.registerCard - Success: uuid=\(String(describing: uuid)), userNo=\(userNo)")
-                                resolve([
-                                    "uuid": uuid ?? "",
-                                    "userNo": userNo
-                                ])
-                            }
                         }
                     },
                     callFailed: { errorCode, errorMessage in
-                        // SDK may call from background thread - ensure we're on main thread
-                        if Thread.isMainThread {
-                            guard !isCompleted else { return }
-                            isCompleted = true
-                            timeoutWorkItem.cancel()
-                        
-                            print("❌ YellPay.registerCard - Failed: Code=\(errorCode), Message=\(errorMessage)")
-                            
-                            // Handle specific error codes with appropriate messages
-                            var errorCodeString: String = "CARD_REGISTER_ERROR"
-                            var errorDescription: String = String(describing: errorMessage)
+                        self.runOnMain {
+                            guard call.fail() else { return }
+                            self.finishFlow("registerCard", call: call)
                             
-                            switch errorCode {
-                            case -100, -101:
-                                errorCodeString = "AUTHENTICATION_ERROR"
-                                errorDescription = "Authentication required. Please complete authentication and user initialization first. (\(String(describing: errorMessage)))"
-                            case -200:
-                                errorCodeString = "INVALID_PARAMETERS"
-                                errorDescription = "Invalid parameters provided. Please check your input. (\(String(describing: errorMessage)))"
-                            case -300:
-                                errorCodeString = "NETWORK_ERROR"
-                                errorDescription = "Network error occurred. Please check your connection and try again. (\(String(describing: errorMessage)))"
-                            case -400:
-                                errorCodeString = "CARD_ALREADY_REGISTERED"
-                                errorDescription = "Card is already registered. (\(String(describing: errorMessage)))"
-                            case -500:
-                                errorCodeString = "CARD_REGISTRATION_FAILED"
-                                errorDescription = "Card registration failed. Please try again. (\(String(describing: errorMessage)))"
-                            default:
-                                // For unknown error codes, use the original message from SDK
-                                // This preserves Japanese error messages from the SDK
-                                errorDescription = String(describing: errorMessage)
-                            }
-                            
-                            // If the error message contains Japanese text, preserve it
-                            let errorMessageString = String(describing: errorMessage)
-                            if errorMessageString.contains("登録") || errorMessageString.contains("失敗") || errorMessageString.contains("再登録") || errorMessageString.contains("最初から") {
-                                errorDescription = errorMessageString
-                            }
+                            print("❌ YellPay.registerCard - Failed: Code=\(errorCode), Message=\(errorMessage)")
                             
-                            reject(errorCodeString, errorDescription, nil)
-                        } else {
-                            DispatchQueue.main.async {
-                                guard !isCompleted else { return }
-                                isCompleted = true
-                                timeoutWorkItem.cancel()
-                                
-                                print("❌ YellPay.registerCard - Failed: Code=\(errorCode), Message=\(errorMessage)")
-                                
-                                // Handle specific error codes with appropriate messages
-                                var errorCodeString: String = "CARD_REGISTER_ERROR"
-                                var errorDescription: String = String(describing: errorMessage)
-                                
-                                switch errorCode {
-                                case -100, -101:
-                                    errorCodeString = "AUTHENTICATION_ERROR"
-                                    errorDescription = "Authentication required. Please complete authentication and user initialization first. (\(String(describing: errorMessage)))"
-                                case -200:
-                                    errorCodeString = "INVALID_PARAMETERS"
-                                    errorDescription = "Invalid parameters provided. Please check your input. (\(String(describing: errorMessage)))"
-                                case -300:
-                                    errorCodeString = "NETWORK_ERROR"
-                                    errorDescription = "Network error occurred. Please check your connection and try again. (\(String(describing: errorMessage)))"
-                                case -400:
-                                    errorCodeString = "CARD_ALREADY_REGISTERED"
-                                    errorDescription = "Card is already registered. (\(String(describing: errorMessage)))"
-                                case -500:
-                                    errorCodeString = "CARD_REGISTRATION_FAILED"
-                                    errorDescription = "Card registration failed. Please try again. (\(String(describing: errorMessage)))"
-                                default:
-                                    errorDescription = String(describing: errorMessage)
-                                }
-                                
-                                let errorMessageString = String(describing: errorMessage)
-                                if errorMessageString.contains("登録") || errorMessageString.contains("失敗") || errorMessageString.contains("再登録") || errorMessageString.contains("最初から") {
-                                    errorDescription = errorMessageString
-                                }
-                                
-                                reject(errorCodeString, errorDescription, nil)
-                            }
+                            let mapped = YellPayCore.mapFlowError(.cardRegister, errorCode: Int(errorCode), errorMessage: errorMessage)
+                            reject(mapped.code, mapped.message, nil)
                         }
                     }
                 )
             } catch {
-                guard !isCompleted else { return }
-                isCompleted = true
-                timeoutWorkItem.cancel()
+                guard call.fail() else { return }
+                self.finishFlow("registerCard", call: call)
                 print("💥 YellPay.registerCard - Exception: \(error)")
                 reject("REGISTER_EXCEPTION", "SDK call failed: \(error.localizedDescription)", error)
             }
@@ -710,6 +717,7 @@ class YellPay: NSObject {
     
     func makePayment(_ uuid: String, userNo: NSNumber, payUserId: String, resolver resolve: @escaping RCTPromiseResolveBlock, rejecter reject: @escaping RCTPromiseRejectBlock) {
         print("🔥 YellPay.makePayment START - uuid: \(uuid), userNo: \(userNo), payUserId: \(payUserId)")
+        YellPayConnectionPool.shared.warmUp(environment: "Production")
         
         // Validate input parameters
         let safeUuid = sanitize(uuid)
@@ -742,15 +750,13 @@ class YellPay: NSObject {
             self.enforceLightMode(on: viewController.view.window)
             
             // Simplified timeout handling
-            var isCompleted = false
-            let timeoutWorkItem = DispatchWorkItem { [weak self] in
-                guard !isCompleted, self != nil else { return }
-                isCompleted = true
+            let call = YellPayCompletionEngine.shared.begin("makePayment", timeout: 60) { [weak self] in
+                guard let self = self else { return }
                 print("⏰ YellPay.makePayment - Payment timed out")
+                self.tearDownFlow("makePayment")
                 reject("PAYMENT_ERROR", "Payment operation timed out", nil)
             }
-            
-            DispatchQueue.main.asyncAfter(deadline: .now() + 60, execute: timeoutWorkItem)
+            self.trackFlow("makePayment", call: call, host: viewController, reject: reject)
             
             autoreleasepool {
                 do {
@@ -767,114 +773,30 @@ class YellPay: NSObject {
                         viewController: viewController,
                         environmentMode: EnvironmentModeEnum.production,
                         callSuccess: { [weak self] uuid, userNo in
-                            // SDK may call from background thread - ensure we're on main thread
-                            if Thread.isMainThread {
-                                guard !isCompleted, self != nil else { return }
-                                isCompleted = true
-                                timeoutWorkItem.cancel()
+                            self?.runOnMain {
+                                guard call.complete() else { return }
+                                self?.finishFlow("makePayment", call: call)
                                 print("✅ YellPay: Payment successful - uuid: \(String(describing: uuid)), userNo: \(userNo)")
                                 resolve([
                                     "uuid": uuid ?? "",
                                     "userNo": userNo
                                 ])
-                            } else {
-                                DispatchQueue.main.async {
-                                    guard !isCompleted, self != nil else { return }
-                                    isCompleted = true
-                                    timeoutWorkItem.cancel()
-                                    print("✅ YellPay: Payment successful - uuid: \(String(describing: uuid)), userNo: \(userNo)")
-                                    resolve([
-                                        "uuid": uuid ?? "",
-                                        "userNo": userNo
-                                    ])
-                                }
                             }
                         },
                         callFailed: { [weak self] errorCode, errorMessage in
-                            // SDK may call from background thread - ensure we're on main thread
-                            if Thread.isMainThread {
-                                guard !isCompleted, self != nil else { return }
-                                isCompleted = true
-                                timeoutWorkItem.cancel()
+                            self?.runOnMain {
+                                guard call.fail() else { return }
+                                self?.finishFlow("makePayment", call: call)
                                 print("❌ YellPay: Payment failed - errorCode: \(errorCode), message: \(errorMessage)")
                                 
-                                // Handle specific error codes with appropriate messages
-                                var errorCodeString: String = "PAYMENT_ERROR"
-                                var errorDescription: String = String(describing: errorMessage)
-                                
-                                switch errorCode {
-                                case -100, -101:
-                                    errorCodeString = "AUTHENTICATION_ERROR"
-                                    errorDescription = "Authentication required. Please complete authentication first. (\(String(describing: errorMessage)))"
-                                case -200:
-                                    errorCodeString = "INVALID_PARAMETERS"
-                                    errorDescription = "Invalid parameters provided. Please check your input. (\(String(describing: errorMessage)))"
-                                case -300:
-                                    errorCodeString = "NETWORK_ERROR"
-                                    errorDescription = "Network error occurred. Please check your connection and try again. (\(String(describing: errorMessage)))"
-                                case -400:
-                                    errorCodeString = "CARD_NOT_REGISTERED"
-                                    errorDescription = "Card not registered. Please register a card first. (\(String(describing: errorMessage)))"
-                                case -500:
-                                    errorCodeString = "PAYMENT_FAILED"
-                                    errorDescription = "Payment failed. Please try again. (\(String(describing: errorMessage)))"
-                                default:
-                                    // For unknown error codes, use the original message from SDK
-                                    // This preserves Japanese error messages from the SDK
-                                    errorDescription = String(describing: errorMessage)
-                                }
-                                
-                                // If the error message contains Japanese text, preserve it
-                                let errorMessageString = String(describing: errorMessage)
-                                if errorMessageString.contains("支払い") || errorMessageString.contains("失敗") || errorMessageString.contains("エラー") || errorMessageString.contains("登録") {
-                                    errorDescription = errorMessageString
-                                }
-                                
-                                reject(errorCodeString, errorDescription, nil)
-                            } else {
-                                DispatchQueue.main.async {
-                                    guard !isCompleted, self != nil else { return }
-                                    isCompleted = true
-                                    timeoutWorkItem.cancel()
-                                    print("❌ YellPay: Payment failed - errorCode: \(errorCode), message: \(errorMessage)")
-                                    
-                                    var errorCodeString: String = "PAYMENT_ERROR"
-                                    var errorDescription: String = String(describing: errorMessage)
-                                    
-                                    switch errorCode {
-                                    case -100, -101:
-                                        errorCodeString = "AUTHENTICATION_ERROR"
-                                        errorDescription = "Authentication required. Please complete authentication first. (\(String(describing: errorMessage)))"
-                                    case -200:
-                                        errorCodeString = "INVALID_PARAMETERS"
-                                        errorDescription = "Invalid parameters provided. Please check your input. (\(String(describing: errorMessage)))"
-                                    case -300:
-                                        errorCodeString = "NETWORK_ERROR"
-                                        errorDescription = "Network error occurred. Please check your connection and try again. (\(String(describing: errorMessage)))"
-                                    case -400:
-                                        errorCodeString = "CARD_NOT_REGISTERED"
-                                        errorDescription = "Card not registered. Please register a card first. (\(String(describing: errorMessage)))"
-                                    case -500:
-                                        errorCodeString = "PAYMENT_FAILED"
-                                        errorDescription = "Payment failed. Please try again. (\(String(describing: errorMessage)))"
-                                    default:
-                                        errorDescription = String(describing: errorMessage)
-                                    }
-                                    
-                                    let errorMessageString = String(describing: errorMessage)
-                                    if errorMessageString.contains("支払い") || errorMessageString.contains("失敗") || errorMessageString.contains("エラー") || errorMessageString.contains("登録") {
-                                        errorDescription = errorMessageString
-                                    }
-                                    
-                                    reject(errorCodeString, errorDescription, nil)
-                                }
+                                let mapped = YellPayCore.mapFlowError(.payment, errorCode: Int(errorCode), errorMessage: errorMessage)
+                                reject(mapped.code, mapped.message, nil)
                             }
                         }
                     )
                 } catch {
-                    guard !isCompleted else { return }
-                    isCompleted = true
-                    timeoutWorkItem.cancel()
+                    guard call.fail() else { return }
+                    self.finishFlow("makePayment", call: call)
                     print("💥 YellPay: Payment crashed - error: \(error)")
                     reject("PAYMENT_ERROR", "Payment method crashed: \(error.localizedDescription)", error)
                 }
@@ -882,6 +804,102 @@ class YellPay: NSObject {
         }
     }
     
+    // MARK: - Scheme Payment Methods
+    
+    /// Pools stream seed/time pairs ([{streamSeed, streamTime}]) for later paymentScheme calls.
+    @objc(addStreamTokens:resolver:rejecter:)
+    func addStreamTokens(_ tokens: NSArray, resolver resolve: @escaping RCTPromiseResolveBlock, rejecter reject: @escaping RCTPromiseRejectBlock) {
+        let parsed = tokens.compactMap { item -> YellPayStreamTokenPool.Token? in
+            guard let dict = item as? [String: Any] else { return nil }
+            let seed = sanitize(YellPayCore.string(dict["streamSeed"]))
+            let time = YellPayCore.int(dict["streamTime"])
+            guard !seed.isEmpty, time > 0 else { return nil }
+            return YellPayStreamTokenPool.Token(seed: seed, time: time)
+        }
+        let pooled = YellPayStreamTokenPool.shared.add(parsed)
+        resolve(["pooled": pooled, "accepted": parsed.count])
+    }
+    
+    @objc(configureStreamTokenPool:maxAgeMs:resolver:rejecter:)
+    func configureStreamTokenPool(_ capacity: NSNumber, maxAgeMs: NSNumber, resolver resolve: @escaping RCTPromiseResolveBlock, rejecter reject: @escaping RCTPromiseRejectBlock) {
+        YellPayStreamTokenPool.shared.configure(capacity: capacity.intValue, maxAge: maxAgeMs.doubleValue / 1000)
+        resolve(["pooled": YellPayStreamTokenPool.shared.count])
+    }
+    
+    /// Scheme-launched payment. An empty streamSeed takes the freshest pooled token.
+    @objc(paymentScheme:userNo:payUserId:streamSeed:streamTime:resolver:rejecter:)
+    func paymentScheme(_ uuid: String, userNo: NSNumber, payUserId: String, streamSeed: String, streamTime: NSNumber, resolver resolve: @escaping RCTPromiseResolveBlock, rejecter reject: @escaping RCTPromiseRejectBlock) {
+        YellPayConnectionPool.shared.warmUp(environment: "Production")
+        
+        let safeUuid = sanitize(uuid)
+        let safePayUserId = sanitize(payUserId)
+        guard !safeUuid.isEmpty, !safePayUserId.isEmpty else {
+            reject("SCHEME_PAYMENT_ERROR", "Invalid parameters", nil)
+            return
+        }
+        
+        let givenToken = YellPayStreamTokenPool.Token(seed: sanitize(streamSeed), time: streamTime.intValue)
+        
+        runOnMain { [weak self] in
+            guard let self = self else {
+                reject("SCHEME_PAYMENT_ERROR", "Module deallocated", nil)
+                return
+            }
+            guard let viewController = self.getCurrentViewController() else {
+                reject("SCHEME_PAYMENT_ERROR", "No view controller available", nil)
+                return
+            }
+            
+            // Take a pooled token only once the payment can actually start, so an early reject keeps it
+            var token = givenToken
+            if token.seed.isEmpty {
+                guard let pooled = YellPayStreamTokenPool.shared.take() else {
+                    reject("NO_STREAM_TOKEN", "No stream seed given and none pooled", nil)
+                    return
+                }
+                token = pooled
+            }
+            
+            self.enforceLightMode(on: viewController.view.window)
+            
+            let call = YellPayCompletionEngine.shared.begin("paymentScheme", timeout: 60) { [weak self] in
+                print("⏰ YellPay.paymentScheme - Payment timed out")
+                self?.tearDownFlow("paymentScheme")
+                reject("SCHEME_PAYMENT_ERROR", "Payment operation timed out", nil)
+            }
+            self.trackFlow("paymentScheme", call: call, host: viewController, reject: reject)
+            
+            RoutePay.callPaymentSchemeUuid(
+                safeUuid,
+                userNo: userNo.intValue,
+                payUserId: safePayUserId,
+                streamSeed: token.seed,
+                streamTime: token.time,
+                viewController: viewController,
+                environmentMode: EnvironmentModeEnum.production,
+                callSuccess: { [weak self] resultUuid, resultUserNo in
+                    self?.runOnMain {
+                        guard call.complete() else { return }
+                        self?.finishFlow("paymentScheme", call: call)
+                        resolve([
+                            "uuid": resultUuid ?? "",
+                            "userNo": resultUserNo
+                        ])
+                    }
+                },
+                callFailed: { [weak self] status, error in
+                    self?.runOnMain {
+                        guard call.fail() else { return }
+                        self?.finishFlow("paymentScheme", call: call)
+                        print("❌ YellPay.paymentScheme failed - Status: \(status), Error: \(String(describing: error))")
+                        let mapped = YellPayCore.mapFlowError(.payment, errorCode: Int(status), errorMessage: error?.localizedDescription)
+                        reject(mapped.code, mapped.message, nil)
+                    }
+                }
+            )
+        }
+    }
+    
     func paymentForQR(_ uuid: String, userNo: NSNumber, payUserId: String, resolver resolve: @escaping RCTPromiseResolveBlock, rejecter reject: @escaping RCTPromiseRejectBlock) {
         DispatchQueue.main.async {
             guard let viewController = self.getCurrentViewController() else {
@@ -901,6 +919,10 @@ class YellPay: NSObject {
             // Verify we're on main thread before SDK call
             assert(Thread.isMainThread, "paymentForQR must be called on main thread")
             
+            let call = YellPayCompletionEngine.shared.begin("paymentForQR", timeout: 60) {
+                reject("QR_PAYMENT_ERROR", "QR payment timed out", nil)
+            }
+            
             // Use the renamed SDK method for QR payment with environmentMode
             // callPaymentForQRUuid has been renamed to callPayment(forQRUuid:...)
             RoutePay.callPayment(
@@ -910,31 +932,19 @@ class YellPay: NSObject {
                 viewController: viewController,
                 environmentMode: EnvironmentModeEnum.production,
                 callSuccess: { resultUuid, resultUserNo in
-                    // SDK may call from background thread - ensure we're on main thread
-                    if Thread.isMainThread {
+                    self.runOnMain {
+                        guard call.complete() else { return }
                         resolve([
                             "uuid": resultUuid ?? "",
                             "userNo": resultUserNo
                         ])
-                    } else {
-                        DispatchQueue.main.async {
-                            resolve([
-                                "uuid": resultUuid ?? "",
-                                "userNo": resultUserNo
-                            ])
-                        }
                     }
                 },
                 callFailed: { status, error in
-                    // SDK may call from background thread - ensure we're on main thread
-                    if Thread.isMainThread {
+                    self.runOnMain {
+                        guard call.fail() else { return }
                         let errorMessage = error?.localizedDescription ?? "Unknown error"
                         reject("QR_PAYMENT_ERROR", "Error \(status): \(errorMessage)", error)
-                    } else {
-                        DispatchQueue.main.async {
-                            let errorMessage = error?.localizedDescription ?? "Unknown error"
-                            reject("QR_PAYMENT_ERROR", "Error \(status): \(errorMessage)", error)
-                        }
                     }
                 }
             )
@@ -944,10 +954,6 @@ class YellPay: NSObject {
     @objc
     func getHistory(_ userId: String, resolver resolve: @escaping RCTPromiseResolveBlock, rejecter reject: @escaping RCTPromiseRejectBlock) {
         let operationKey = "getHistory"
-        guard !YellPay.crashedOperations.contains(operationKey) else {
-            reject("GET_HISTORY_CIRCUIT_BREAKER", "Get history operation has failed too many times", nil)
-            return
-        }
         
         // Input validation
         let safeUserId = sanitize(userId)
@@ -967,54 +973,36 @@ class YellPay: NSObject {
                 return
             }
             
-            var isCompleted = false
-            let timeoutWorkItem = DispatchWorkItem { [weak self] in
-                guard !isCompleted, let self = self else { return }
-                isCompleted = true
+            // Gate only calls that reach the SDK, so a rejected one never holds a half-open probe slot
+            guard YellPayCircuitBreaker.shared.allow(operationKey) else {
+                reject("GET_HISTORY_CIRCUIT_BREAKER", "Get history operation has failed too many times", nil)
+                return
+            }
+            
+            let call = YellPayCompletionEngine.shared.begin(operationKey, timeout: 30) { [weak self] in
+                guard let self = self else { return }
                 print("⏰ YellPay.getHistory - Operation timed out")
                 
-                if self.shouldBlockOperation(operationKey) {
-                    self.blockOperation(operationKey)
-                }
-                
                 reject("GET_HISTORY_TIMEOUT", "Get history operation timed out", nil)
             }
             
-            DispatchQueue.main.asyncAfter(deadline: .now() + 30, execute: timeoutWorkItem)
-            
             autoreleasepool {
                 do {
                     RoutePay.callHistoryUserId(
                         safeUserId,
                         viewController: viewController,
                         callSuccess: { [weak self] history in
-                            guard !isCompleted, let self = self else { return }
-                            isCompleted = true
-                            timeoutWorkItem.cancel()
+                            guard call.complete(), let self = self else { return }
                             resolve(history)
                         },
                         callFailed: { [weak self] errorCode, errorMessage in
-                            guard !isCompleted, let self = self else { return }
-                            isCompleted = true
-                            timeoutWorkItem.cancel()
-                            
-                            YellPay.operationAttempts[operationKey] = (YellPay.operationAttempts[operationKey] ?? 0) + 1
-                            if YellPay.operationAttempts[operationKey]! >= YellPay.maxAttempts {
-                                YellPay.crashedOperations.insert(operationKey)
-                            }
+                            guard call.fail(), let self = self else { return }
                             
                             reject("GET_HISTORY_ERROR", "Error \(errorCode): \(errorMessage)", nil)
                         }
                     )
                 } catch {
-                    guard !isCompleted else { return }
-                    isCompleted = true
-                    timeoutWorkItem.cancel()
-                    
-                    YellPay.operationAttempts[operationKey] = (YellPay.operationAttempts[operationKey] ?? 0) + 1
-                    if YellPay.operationAttempts[operationKey]! >= YellPay.maxAttempts {
-                        YellPay.crashedOperations.insert(operationKey)
-                    }
+                    guard call.fail() else { return }
                     
                     print("💥 YellPay.getHistory - Exception: \(error)")
                     reject("GET_HISTORY_EXCEPTION", "Exception: \(error.localizedDescription)", error)
@@ -1026,10 +1014,6 @@ class YellPay: NSObject {
     @objc
     func cardSelect(_ userId: String, resolver resolve: @escaping RCTPromiseResolveBlock, rejecter reject: @escaping RCTPromiseRejectBlock) {
         let operationKey = "cardSelect"
-        guard !YellPay.crashedOperations.contains(operationKey) else {
-            reject("CARD_SELECT_CIRCUIT_BREAKER", "Card select operation has failed too many times", nil)
-            return
-        }
         
         DispatchQueue.main.async { [weak self] in
             guard let self = self else { return }
@@ -1044,6 +1028,11 @@ class YellPay: NSObject {
                 return
             }
             
+            guard YellPayCircuitBreaker.shared.allow(operationKey) else {
+                reject("CARD_SELECT_CIRCUIT_BREAKER", "Card select operation has failed too many times", nil)
+                return
+            }
+            
             // Force light mode on view controller
             viewController.overrideUserInterfaceStyle = .light
             
@@ -1052,22 +1041,15 @@ class YellPay: NSObject {
             let originalValue = UserDefaults.standard.bool(forKey: "_UIConstraintBasedLayoutLogUnsatisfiable")
             UserDefaults.standard.set(false, forKey: "_UIConstraintBasedLayoutLogUnsatisfiable")
             
-            let timeoutTimer = DispatchSource.makeTimerSource(queue: DispatchQueue.main)
-            var isCompleted = false
-            
-            timeoutTimer.schedule(deadline: .now() + 60) // 60 second timeout
-            timeoutTimer.setEventHandler {
-                if !isCompleted {
-                    isCompleted = true
-                    
-                    // Restore original constraint logging setting
-                    UserDefaults.standard.set(originalValue, forKey: "_UIConstraintBasedLayoutLogUnsatisfiable")
-                    
-                    reject("CARD_SELECT_TIMEOUT", "Card selection timed out", nil)
-                }
-                timeoutTimer.cancel()
+            let call = YellPayCompletionEngine.shared.begin(operationKey, timeout: 60) { [weak self] in
+                // Tear-down restores the original constraint logging setting
+                self?.tearDownFlow(operationKey)
+                
+                reject("CARD_SELECT_TIMEOUT", "Card selection timed out", nil)
+            }
+            self.trackFlow(operationKey, call: call, host: viewController, reject: reject) {
+                UserDefaults.standard.set(originalValue, forKey: "_UIConstraintBasedLayoutLogUnsatisfiable")
             }
-            timeoutTimer.resume()
             
             autoreleasepool {
                 do {
@@ -1079,9 +1061,9 @@ class YellPay: NSObject {
                         payUserId: userId,
                         viewController: viewController,
                         callSuccess: { [weak self] selectedCard in
-                            guard !isCompleted else { return }
-                            isCompleted = true
-                            timeoutTimer.cancel()
+                            guard call.complete() else { return }
+                            self?.finishFlow(operationKey, call: call)
+                            self?.invalidateMainCard()
                             
                             // Restore original constraint logging setting
                             UserDefaults.standard.set(originalValue, forKey: "_UIConstraintBasedLayoutLogUnsatisfiable")
@@ -1089,26 +1071,19 @@ class YellPay: NSObject {
                             resolve(selectedCard)
                         },
                         callFailed: { [weak self] status, error in
-                            guard !isCompleted else { return }
-                            isCompleted = true
-                            timeoutTimer.cancel()
+                            guard self?.claimFailure(call, error) ?? call.fail() else { return }
+                            self?.finishFlow(operationKey, call: call)
                             
                             // Restore original constraint logging setting
                             UserDefaults.standard.set(originalValue, forKey: "_UIConstraintBasedLayoutLogUnsatisfiable")
                             
-                            YellPay.operationAttempts[operationKey] = (YellPay.operationAttempts[operationKey] ?? 0) + 1
-                            if YellPay.operationAttempts[operationKey]! >= YellPay.maxAttempts {
-                                YellPay.crashedOperations.insert(operationKey)
-                            }
-                            
                             let errorMessage = error?.localizedDescription ?? "Unknown error"
                             reject("CARD_SELECT_ERROR", "Error \(status): \(errorMessage)", error)
                         }
                     )
                 } catch {
-                    guard !isCompleted else { return }
-                    isCompleted = true
-                    timeoutTimer.cancel()
+                    guard call.fail() else { return }
+                    self.finishFlow(operationKey, call: call)
                     
                     // Restore original constraint logging setting
                     UserDefaults.standard.set(originalValue, forKey: "_UIConstraintBasedLayoutLogUnsatisfiable")
@@ -1119,45 +1094,257 @@ class YellPay: NSObject {
         }
     }
     
+    // MARK: - UI Flow Handles
+    
+    // SDK flows that present their own view controllers, keyed by operation name.
+    // A timeout or cancelFlow dismisses what the flow presented instead of leaving
+    // it on screen holding the SDK session. Main thread only.
+    private struct UIFlow {
+        let call: YellPayCompletionEngine.Call
+        weak var host: UIViewController?
+        let reject: RCTPromiseRejectBlock
+        let cleanup: (() -> Void)?
+    }
+    
+    private static var uiFlows: [String: UIFlow] = [:]
+    
+    private func trackFlow(_ name: String, call: YellPayCompletionEngine.Call, host: UIViewController, reject: @escaping RCTPromiseRejectBlock, cleanup: (() -> Void)? = nil) {
+        YellPay.uiFlows[name] = UIFlow(call: call, host: host, reject: reject, cleanup: cleanup)
+    }
+    
+    /// Claims a failed SDK callback. A user dismissing the SDK screen is not an operation
+    /// failure, so it settles the call like a cancel instead of counting against the breaker.
+    private func claimFailure(_ call: YellPayCompletionEngine.Call, _ error: Error?) -> Bool {
+        let message = error?.localizedDescription ?? ""
+        return message.contains("cancelled") || message.contains("canceled") ? call.cancel() : call.fail()
+    }
+    
+    /// Forgets a flow that settled through its own SDK callback.
+    private func finishFlow(_ name: String, call: YellPayCompletionEngine.Call) {
+        runOnMain {
+            if YellPay.uiFlows[name]?.call == call {
+                YellPay.uiFlows.removeValue(forKey: name)
+            }
+        }
+    }
+    
+    /// Dismisses the controllers the flow presented and runs its cleanup.
+    @discardableResult
+    private func tearDownFlow(_ name: String) -> UIFlow? {
+        guard let flow = YellPay.uiFlows.removeValue(forKey: name) else { return nil }
+        if let host = flow.host, host.presentedViewController != nil {
+            print("🧹 YellPay.\(name) - Dismissing SDK controllers")
+            host.dismiss(animated: true)
+        }
+        flow.cleanup?()
+        return flow
+    }
+    
+    /// Cancels a running registerCard / makePayment / cardSelect / paymentScheme flow. Its promise rejects
+    /// with FLOW_CANCELLED; resolves false when the flow is not running.
     @objc
-    func getMainCreditCard(_ resolve: @escaping RCTPromiseResolveBlock, rejecter reject: @escaping RCTPromiseRejectBlock) {
-        let operationKey = "getMainCreditCard"
-        guard !YellPay.crashedOperations.contains(operationKey) else {
-            reject("GET_MAIN_CARD_CIRCUIT_BREAKER", "Get main credit card operation has failed too many times", nil)
+    func cancelFlow(_ flow: String, resolver resolve: @escaping RCTPromiseResolveBlock, rejecter reject: @escaping RCTPromiseRejectBlock) {
+        runOnMain {
+            guard let active = YellPay.uiFlows[flow], active.call.cancel() else {
+                resolve(false)
+                return
+            }
+            self.tearDownFlow(flow)
+            active.reject("FLOW_CANCELLED", "\(flow) was cancelled", nil)
+            resolve(true)
+        }
+    }
+    
+    // MARK: - Single-Flight
+    
+    typealias PromiseBlocks = (resolve: RCTPromiseResolveBlock, reject: RCTPromiseRejectBlock)
+    
+    // Callers waiting on an identical in-flight read, keyed by method + arguments.
+    // Entry points run on the module queue (and batch / syncNotifications call in
+    // from their own queues) while completions arrive anywhere, so every access
+    // goes through inFlightLock.
+    private static var inFlight: [String: [PromiseBlocks]] = [:]
+    private static let inFlightLock = NSLock()
+    
+    /// Returns nil when an identical call is already running (the caller joins it);
+    /// otherwise blocks that settle every joined caller with the one SDK result.
+    private func singleFlight(_ key: String, resolve: @escaping RCTPromiseResolveBlock, reject: @escaping RCTPromiseRejectBlock) -> PromiseBlocks? {
+        YellPay.inFlightLock.lock()
+        if YellPay.inFlight[key] != nil {
+            YellPay.inFlight[key]?.append((resolve, reject))
+            YellPay.inFlightLock.unlock()
+            print("🔗 YellPay - Joined in-flight \(key.split(separator: "|").first ?? "")")
+            return nil
+        }
+        YellPay.inFlight[key] = [(resolve, reject)]
+        YellPay.inFlightLock.unlock()
+        
+        func settle(_ deliver: (PromiseBlocks) -> Void) {
+            YellPay.inFlightLock.lock()
+            let waiters = YellPay.inFlight.removeValue(forKey: key) ?? []
+            YellPay.inFlightLock.unlock()
+            waiters.forEach(deliver)
+        }
+        return (
+            resolve: { value in settle { $0.resolve(value) } },
+            reject: { code, message, error in settle { $0.reject(code, message, error) } }
+        )
+    }
+    
+    // MARK: - Main Card Cache
+    
+    // Main card from the last lookup or main-card setting, with the payUserId it belongs to.
+    // Read and written on main only; cleared whenever the user registers or selects a card,
+    // on any (re-)authentication or initUser, and by clearMainCardCache on logout.
+    private static var cachedMainCard: [AnyHashable: Any]?
+    private static var cachedMainCardOwner: String?
+    private static var cachedMainCardAt: Date?
+    static let mainCardTTL: TimeInterval = 300
+    
+    private func freshMainCard(for payUserId: String) -> [AnyHashable: Any]? {
+        guard let card = YellPay.cachedMainCard, YellPay.cachedMainCardOwner == payUserId,
+              let at = YellPay.cachedMainCardAt,
+              Date().timeIntervalSince(at) < YellPay.mainCardTTL else { return nil }
+        return card
+    }
+    
+    private func storeMainCard(_ card: [AnyHashable: Any]?, owner payUserId: String?) {
+        guard let card = card, let payUserId = payUserId else {
+            YellPay.cachedMainCard = nil
+            YellPay.cachedMainCardOwner = nil
+            YellPay.cachedMainCardAt = nil
             return
         }
+        YellPay.cachedMainCard = card
+        YellPay.cachedMainCardOwner = payUserId
+        YellPay.cachedMainCardAt = Date()
+    }
+    
+    private func invalidateMainCard() {
+        runOnMain { self.storeMainCard(nil, owner: nil) }
+    }
+    
+    /// Drops the cached main card; call on logout so the next user never sees it.
+    @objc
+    func clearMainCardCache(_ resolve: @escaping RCTPromiseResolveBlock, rejecter reject: @escaping RCTPromiseRejectBlock) {
+        runOnMain {
+            self.storeMainCard(nil, owner: nil)
+            resolve(true)
+        }
+    }
+    
+    @objc(getMainCreditCard:resolver:rejecter:)
+    func getMainCreditCard(_ payUserId: String, resolver resolve: @escaping RCTPromiseResolveBlock, rejecter reject: @escaping RCTPromiseRejectBlock) {
+        let operationKey = "getMainCreditCard"
+        let safePayUserId = sanitize(payUserId)
         
-        autoreleasepool {
-            do {
-                // Use the actual SDK method name that exists
+        // Main card lookup is normally followed by a payment - get the hosts warm now
+        YellPayConnectionPool.shared.warmUp(environment: "Production")
+        
+        DispatchQueue.main.async { [weak self] in
+            guard let self = self else {
+                reject("GET_MAIN_CARD_ERROR", "Module deallocated", nil)
+                return
+            }
+            
+            // A cache hit never reaches the SDK, so it neither needs nor spends a breaker probe
+            if let card = self.freshMainCard(for: safePayUserId) {
+                resolve(card)
+                return
+            }
+            
+            guard YellPayCircuitBreaker.shared.allow(operationKey) else {
+                reject("GET_MAIN_CARD_CIRCUIT_BREAKER", "Get main credit card operation has failed too many times", nil)
+                return
+            }
+            
+            let call = YellPayCompletionEngine.shared.begin(operationKey, timeout: 30) {
+                reject("GET_MAIN_CARD_TIMEOUT", "Get main credit card timed out", nil)
+            }
+            
+            autoreleasepool {
                 RoutePay.callGetMainCreditCardResponseSuccess(
                     { [weak self] cardInfo in
-                        // cardInfo is the card information
-                        resolve(cardInfo)
+                        self?.runOnMain {
+                            guard call.complete() else { return }
+                            self?.storeMainCard(cardInfo, owner: safePayUserId.isEmpty ? nil : safePayUserId)
+                            // cardInfo is the card information
+                            resolve(cardInfo)
+                        }
                     },
                     callFailed: { [weak self] status, error in
-                        YellPay.operationAttempts[operationKey] = (YellPay.operationAttempts[operationKey] ?? 0) + 1
-                        if YellPay.operationAttempts[operationKey]! >= YellPay.maxAttempts {
-                            YellPay.crashedOperations.insert(operationKey)
+                        self?.runOnMain {
+                            guard call.fail() else { return }
+                            
+                            let errorMessage = error?.localizedDescription ?? "Unknown error"
+                            reject("GET_MAIN_CARD_ERROR", "Error \(status): \(errorMessage)", error)
                         }
-                        
-                        let errorMessage = error?.localizedDescription ?? "Unknown error"
-                        reject("GET_MAIN_CARD_ERROR", "Error \(status): \(errorMessage)", error)
                     }
                 )
-            } catch {
-                reject("GET_MAIN_CARD_EXCEPTION", "Exception: \(error.localizedDescription)", error)
             }
         }
     }
     
+    /// Sets the main card and replaces the cached one with the card the SDK returns.
+    @objc(setMainCard:userNo:resolver:rejecter:)
+    func setMainCard(_ uuid: String, userNo: NSNumber, resolver resolve: @escaping RCTPromiseResolveBlock, rejecter reject: @escaping RCTPromiseRejectBlock) {
+        let safeUuid = sanitize(uuid)
+        guard !safeUuid.isEmpty else {
+            reject("MAIN_CARD_SETTING_ERROR", "uuid cannot be empty", nil)
+            return
+        }
+        
+        DispatchQueue.main.async { [weak self] in
+            guard let self = self else { return }
+            // The SDK does not say whose card this is; it replaces the current user's cached one
+            let owner = YellPay.cachedMainCardOwner
+            self.storeMainCard(nil, owner: nil)
+            
+            RoutePay.callMainCardSettingUuid(
+                safeUuid,
+                userNo: userNo.intValue,
+                callSuccess: { [weak self] card in
+                    self?.runOnMain {
+                        self?.storeMainCard(card, owner: owner)
+                        resolve(card ?? [:])
+                    }
+                },
+                callFailed: { [weak self] status, error in
+                    self?.runOnMain {
+                        self?.invalidateMainCard()
+                        let errorMessage = error?.localizedDescription ?? "Unknown error"
+                        reject("MAIN_CARD_SETTING_ERROR", "Error \(status): \(errorMessage)", error)
+                    }
+                }
+            )
+        }
+    }
+    
+    /// Speculative payment setup for idle screens: warms the backend connections and
+    /// caches the main card so the pay tap can go straight to the payment UI.
+    /// Never rejects; resolves `{ ready, cached, card? }`.
+    @objc(preparePayment:resolver:rejecter:)
+    func preparePayment(_ payUserId: String, resolver resolve: @escaping RCTPromiseResolveBlock, rejecter reject: @escaping RCTPromiseRejectBlock) {
+        DispatchQueue.main.async { [weak self] in
+            guard let self = self else { return }
+            YellPayConnectionPool.shared.warmUp(environment: "Production")
+            
+            if let card = self.freshMainCard(for: self.sanitize(payUserId)) {
+                resolve(["ready": true, "cached": true, "card": card])
+                return
+            }
+            
+            self.getMainCreditCard(payUserId, resolver: { card in
+                resolve(["ready": true, "cached": false, "card": card ?? NSNull()])
+            }, rejecter: { code, message, _ in
+                resolve(["ready": false, "code": code ?? "PREPARE_PAYMENT_ERROR", "message": message ?? ""])
+            })
+        }
+    }
+    
     @objc
     func getUserInfo(_ userId: String, resolver resolve: @escaping RCTPromiseResolveBlock, rejecter reject: @escaping RCTPromiseRejectBlock) {
         let operationKey = "getUserInfo"
-        guard !YellPay.crashedOperations.contains(operationKey) else {
-            reject("GET_USER_INFO_CIRCUIT_BREAKER", "Get user info operation has failed too many times", nil)
-            return
-        }
         
         // Input validation
         let safeUserId = sanitize(userId)
@@ -1166,178 +1353,60 @@ class YellPay: NSObject {
             return
         }
         
-        DispatchQueue.main.async { [weak self] in
+        guard let flight = singleFlight("getUserInfo|\(safeUserId)", resolve: resolve, reject: reject) else { return }
+        let resolve = flight.resolve, reject = flight.reject
+        
+        // Only the flight leader reaches the SDK, so only it may take a half-open probe slot
+        guard YellPayCircuitBreaker.shared.allow(operationKey) else {
+            reject("GET_USER_INFO_CIRCUIT_BREAKER", "Get user info operation has failed too many times", nil)
+            return
+        }
+        
+        YellPay.executionQueue(for: operationKey).async { [weak self] in
             guard let self = self else {
                 reject("GET_USER_INFO_ERROR", "Module deallocated", nil)
                 return
             }
             
             print("🔄 YellPay.getUserInfo - Calling SDK with userId: \(safeUserId)")
-            var isCompleted = false
-            let timeoutWorkItem = DispatchWorkItem { [weak self] in
-                guard !isCompleted, let self = self else { return }
-                isCompleted = true
+            let call = YellPayCompletionEngine.shared.begin(operationKey, timeout: 30) { [weak self] in
+                guard let self = self else { return }
                 print("⏰ YellPay.getUserInfo - Timeout")
                 reject("GET_USER_INFO_TIMEOUT", "Operation timed out", nil)
             }
             
-            DispatchQueue.main.asyncAfter(deadline: .now() + 30, execute: timeoutWorkItem)
-            
             autoreleasepool {
                 do {
-                    // Verify we're on main thread before SDK call
-                    assert(Thread.isMainThread, "getUserInfo must be called on main thread")
-                    
                     // Use the version with environmentMode for production
                     // Note: getUserInfo does NOT require authentication - it only needs userId
                     RoutePay.callGetUserInfoUserId(
                         safeUserId,
                         environmentMode: EnvironmentModeEnum.production,
                         callSuccess: { [weak self] userCertificates in
-                            // SDK may call from background thread - ensure we're on main thread
-                            if Thread.isMainThread {
-                                guard !isCompleted, let self = self else { return }
-                                isCompleted = true
-                                timeoutWorkItem.cancel()
+                            self?.decodeThenComplete(operationKey, { YellPayCore.certificates(from: userCertificates) }) { certificatesArray in
+                                guard call.complete() else { return }
                                 
-                                var certificatesArray: [[String: Any]] = []
-                                if let certificates = userCertificates {
-                                    for certificate in certificates {
-                                        if let certDict = certificate as? [String: Any] {
-                                            // Safely extract values with nil checking
-                                            let certificateType: String = {
-                                                if let value = certDict["certificateType"] {
-                                                    if value is NSNull { return "" }
-                                                    if let str = value as? String { return str }
-                                                    if let num = value as? NSNumber { return num.stringValue }
-                                                }
-                                                return ""
-                                            }()
-                                            
-                                            let status: Int = {
-                                                if let value = certDict["status"] {
-                                                    if value is NSNull { return 0 }
-                                                    if let num = value as? Int { return num }
-                                                    if let num = value as? NSNumber { return num.intValue }
-                                                }
-                                                return 0
-                                            }()
-                                            
-                                            let additionalInfo: String = {
-                                                if let value = certDict["additionalInfo"] {
-                                                    if value is NSNull { return "" }
-                                                    if let str = value as? String { return str }
-                                                    if let num = value as? NSNumber { return num.stringValue }
-                                                }
-                                                return ""
-                                            }()
-                                            
-                                            certificatesArray.append([
-                                                "certificateType": certificateType,
-                                                "status": status,
-                                                "additionalInfo": additionalInfo
-                                            ])
-                                        }
-                                    }
-                                }
                                 print("✅ YellPay.getUserInfo - Returning \(certificatesArray.count) certificates")
                                 resolve(certificatesArray)
-                            } else {
-                                DispatchQueue.main.async {
-                                    guard !isCompleted, let self = self else { return }
-                                    isCompleted = true
-                                    timeoutWorkItem.cancel()
-                                    
-                                    var certificatesArray: [[String: Any]] = []
-                                    if let certificates = userCertificates {
-                                        for certificate in certificates {
-                                            if let certDict = certificate as? [String: Any] {
-                                                // Safely extract values with nil checking
-                                                let certificateType: String = {
-                                                    if let value = certDict["certificateType"] {
-                                                        if value is NSNull { return "" }
-                                                        if let str = value as? String { return str }
-                                                        if let num = value as? NSNumber { return num.stringValue }
-                                                    }
-                                                    return ""
-                                                }()
-                                                
-                                                let status: Int = {
-                                                    if let value = certDict["status"] {
-                                                        if value is NSNull { return 0 }
-                                                        if let num = value as? Int { return num }
-                                                        if let num = value as? NSNumber { return num.intValue }
-                                                    }
-                                                    return 0
-                                                }()
-                                                
-                                                let additionalInfo: String = {
-                                                    if let value = certDict["additionalInfo"] {
-                                                        if value is NSNull { return "" }
-                                                        if let str = value as? String { return str }
-                                                        if let num = value as? NSNumber { return num.stringValue }
-                                                    }
-                                                    return ""
-                                                }()
-                                                
-                                                certificatesArray.append([
-                                                    "certificateType": certificateType,
-                                                    "status": status,
-                                                    "additionalInfo": additionalInfo
-                                                ])
-                                            }
-                                        }
-                                    }
-                                    print("✅ YellPay.getUserInfo - Returning \(certificatesArray.count) certificates")
-                                    resolve(certificatesArray)
-                                }
                             }
                         },
                         callFailed: { [weak self] errorCode, errorMessage in
-                            // SDK may call from background thread - ensure we're on main thread
-                            if Thread.isMainThread {
-                                guard !isCompleted else { return }
-                                isCompleted = true
-                                timeoutWorkItem.cancel()
+                            self?.runOnMain {
+                                guard call.fail() else { return }
                                 
                                 print("❌ YellPay.getUserInfo failed - Code: \(errorCode), Message: \(errorMessage)")
                                 
-                                YellPay.operationAttempts[operationKey] = (YellPay.operationAttempts[operationKey] ?? 0) + 1
-                                if YellPay.operationAttempts[operationKey]! >= YellPay.maxAttempts {
-                                    YellPay.crashedOperations.insert(operationKey)
-                                }
-                                
                                 reject("GET_USER_INFO_ERROR", "Error \(errorCode): \(errorMessage)", nil)
-                            } else {
-                                DispatchQueue.main.async {
-                                    guard !isCompleted else { return }
-                                    isCompleted = true
-                                    timeoutWorkItem.cancel()
-                                    
-                                    print("❌ YellPay.getUserInfo failed - Code: \(errorCode), Message: \(errorMessage)")
-                                    
-                                    YellPay.operationAttempts[operationKey] = (YellPay.operationAttempts[operationKey] ?? 0) + 1
-                                    if YellPay.operationAttempts[operationKey]! >= YellPay.maxAttempts {
-                                        YellPay.crashedOperations.insert(operationKey)
-                                    }
-                                    
-                                    reject("GET_USER_INFO_ERROR", "Error \(errorCode): \(errorMessage)", nil)
-                                }
                             }
                         }
                     )
                 } catch {
-                    guard !isCompleted else { return }
-                    isCompleted = true
-                    timeoutWorkItem.cancel()
-                    
-                    YellPay.operationAttempts[operationKey] = (YellPay.operationAttempts[operationKey] ?? 0) + 1
-                    if YellPay.operationAttempts[operationKey]! >= YellPay.maxAttempts {
-                        YellPay.crashedOperations.insert(operationKey)
+                    self.runOnMain {
+                        guard call.fail() else { return }
+                        
+                        print("💥 YellPay.getUserInfo - Exception: \(error)")
+                        reject("GET_USER_INFO_EXCEPTION", "Exception: \(error.localizedDescription)", error)
                     }
-                    
-                    print("💥 YellPay.getUserInfo - Exception: \(error)")
-                    reject("GET_USER_INFO_EXCEPTION", "Exception: \(error.localizedDescription)", error)
                 }
             }
         }
@@ -1346,10 +1415,6 @@ class YellPay: NSObject {
     @objc
     func viewCertificate(_ userId: String, resolver resolve: @escaping RCTPromiseResolveBlock, rejecter reject: @escaping RCTPromiseRejectBlock) {
         let operationKey = "viewCertificate"
-        guard !YellPay.crashedOperations.contains(operationKey) else {
-            reject("VIEW_CERTIFICATE_CIRCUIT_BREAKER", "View certificate operation has failed too many times", nil)
-            return
-        }
         
         // Input validation
         let safeUserId = sanitize(userId)
@@ -1358,6 +1423,9 @@ class YellPay: NSObject {
             return
         }
         
+        guard let flight = singleFlight("viewCertificate|\(safeUserId)", resolve: resolve, reject: reject) else { return }
+        let resolve = flight.resolve, reject = flight.reject
+        
         DispatchQueue.main.async { [weak self] in
             guard let self = self else {
                 reject("VIEW_CERTIFICATE_ERROR", "Module deallocated", nil)
@@ -1369,54 +1437,36 @@ class YellPay: NSObject {
                 return
             }
             
-            var isCompleted = false
-            let timeoutWorkItem = DispatchWorkItem { [weak self] in
-                guard !isCompleted, let self = self else { return }
-                isCompleted = true
+            // Only the flight leader that reaches the SDK may take a half-open probe slot
+            guard YellPayCircuitBreaker.shared.allow(operationKey) else {
+                reject("VIEW_CERTIFICATE_CIRCUIT_BREAKER", "View certificate operation has failed too many times", nil)
+                return
+            }
+            
+            let call = YellPayCompletionEngine.shared.begin(operationKey, timeout: 30) { [weak self] in
+                guard let self = self else { return }
                 print("⏰ YellPay.viewCertificate - Operation timed out")
                 
-                if self.shouldBlockOperation(operationKey) {
-                    self.blockOperation(operationKey)
-                }
-                
                 reject("VIEW_CERTIFICATE_TIMEOUT", "View certificate operation timed out", nil)
             }
             
-            DispatchQueue.main.asyncAfter(deadline: .now() + 30, execute: timeoutWorkItem)
-            
             autoreleasepool {
                 do {
                     RoutePay.callViewCertificateUserId(
                         safeUserId,
                         viewController: viewController,
                         callSuccess: { [weak self] in
-                            guard !isCompleted, let self = self else { return }
-                            isCompleted = true
-                            timeoutWorkItem.cancel()
+                            guard call.complete(), let self = self else { return }
                             resolve(["success": true])
                         },
                         callFailed: { [weak self] errorCode, errorMessage in
-                            guard !isCompleted, let self = self else { return }
-                            isCompleted = true
-                            timeoutWorkItem.cancel()
-                            
-                            YellPay.operationAttempts[operationKey] = (YellPay.operationAttempts[operationKey] ?? 0) + 1
-                            if YellPay.operationAttempts[operationKey]! >= YellPay.maxAttempts {
-                                YellPay.crashedOperations.insert(operationKey)
-                            }
+                            guard call.fail(), let self = self else { return }
                             
                             reject("VIEW_CERTIFICATE_ERROR", "Error \(errorCode): \(errorMessage)", nil)
                         }
                     )
                 } catch {
-                    guard !isCompleted else { return }
-                    isCompleted = true
-                    timeoutWorkItem.cancel()
-                    
-                    YellPay.operationAttempts[operationKey] = (YellPay.operationAttempts[operationKey] ?? 0) + 1
-                    if YellPay.operationAttempts[operationKey]! >= YellPay.maxAttempts {
-                        YellPay.crashedOperations.insert(operationKey)
-                    }
+                    guard call.fail() else { return }
                     
                     print("💥 YellPay.viewCertificate - Exception: \(error)")
                     reject("VIEW_CERTIFICATE_EXCEPTION", "Exception: \(error.localizedDescription)", error)
@@ -1428,10 +1478,6 @@ class YellPay: NSObject {
     @objc
     func getNotification(_ userId: String, lastUpdate: NSNumber, resolver resolve: @escaping RCTPromiseResolveBlock, rejecter reject: @escaping RCTPromiseRejectBlock) {
         let operationKey = "getNotification"
-        guard !YellPay.crashedOperations.contains(operationKey) else {
-            reject("GET_NOTIFICATION_CIRCUIT_BREAKER", "Get notification operation has failed too many times", nil)
-            return
-        }
         
         // Input validation
         let safeUserId = sanitize(userId)
@@ -1440,94 +1486,139 @@ class YellPay: NSObject {
             return
         }
         
-        DispatchQueue.main.async { [weak self] in
+        guard let flight = singleFlight("getNotification|\(safeUserId)|\(lastUpdate.intValue)", resolve: resolve, reject: reject) else { return }
+        let resolve = flight.resolve, reject = flight.reject
+        
+        // Only the flight leader reaches the SDK, so only it may take a half-open probe slot
+        guard YellPayCircuitBreaker.shared.allow(operationKey) else {
+            reject("GET_NOTIFICATION_CIRCUIT_BREAKER", "Get notification operation has failed too many times", nil)
+            return
+        }
+        
+        YellPay.executionQueue(for: operationKey).async { [weak self] in
             guard let self = self else {
                 reject("GET_NOTIFICATION_ERROR", "Module deallocated", nil)
                 return
             }
             
-            var isCompleted = false
-            let timeoutWorkItem = DispatchWorkItem { [weak self] in
-                guard !isCompleted, let self = self else { return }
-                isCompleted = true
+            let call = YellPayCompletionEngine.shared.begin(operationKey, timeout: 30) { [weak self] in
+                guard let self = self else { return }
                 print("⏰ YellPay.getNotification - Operation timed out")
                 
-                if self.shouldBlockOperation(operationKey) {
-                    self.blockOperation(operationKey)
-                }
-                
                 reject("GET_NOTIFICATION_TIMEOUT", "Get notification operation timed out", nil)
             }
             
-            DispatchQueue.main.asyncAfter(deadline: .now() + 30, execute: timeoutWorkItem)
-            
             autoreleasepool {
                 do {
                     RoutePay.callGetNotificationUserId(
                         safeUserId,
                         lastUpdate: lastUpdate.intValue,
-                        callSuccess: { [weak self] notificationCount, notifications in
-                            guard !isCompleted, let self = self else { return }
-                            isCompleted = true
-                            timeoutWorkItem.cancel()
-                            
-                            // Convert notifications array to serializable format
-                            var notificationsArray: [[String: Any]] = []
-                            if let notificationList = notifications {
-                                for notification in notificationList {
-                                    if let notifDict = notification as? [String: Any] {
-                                        notificationsArray.append([
-                                            "id": notifDict["notificationId"] as? String ?? "",
-                                            "title": notifDict["title"] as? String ?? "",
-                                            "message": notifDict["message"] as? String ?? "",
-                                            "date": notifDict["date"] as? String ?? ""
-                                        ])
-                                    }
-                                }
+                        callSuccess: { [weak self] lastUpdateNotification, notifications in
+                            self?.decodeThenComplete(operationKey, { YellPayCore.notifications(from: notifications) }) { notificationsArray in
+                                guard call.complete() else { return }
+                                
+                                resolve([
+                                    "count": lastUpdateNotification,
+                                    "lastUpdate": lastUpdateNotification,
+                                    "notifications": notificationsArray
+                                ])
                             }
-                            
-                            resolve([
-                                "count": notificationCount,
-                                "notifications": notificationsArray
-                            ])
                         },
                         callFailed: { [weak self] errorCode, errorMessage in
-                            guard !isCompleted, let self = self else { return }
-                            isCompleted = true
-                            timeoutWorkItem.cancel()
-                            
-                            YellPay.operationAttempts[operationKey] = (YellPay.operationAttempts[operationKey] ?? 0) + 1
-                            if YellPay.operationAttempts[operationKey]! >= YellPay.maxAttempts {
-                                YellPay.crashedOperations.insert(operationKey)
+                            self?.runOnMain {
+                                guard call.fail() else { return }
+                                
+                                reject("GET_NOTIFICATION_ERROR", "Error \(errorCode): \(errorMessage)", nil)
                             }
-                            
-                            reject("GET_NOTIFICATION_ERROR", "Error \(errorCode): \(errorMessage)", nil)
                         }
                     )
                 } catch {
-                    guard !isCompleted else { return }
-                    isCompleted = true
-                    timeoutWorkItem.cancel()
-                    
-                    YellPay.operationAttempts[operationKey] = (YellPay.operationAttempts[operationKey] ?? 0) + 1
-                    if YellPay.operationAttempts[operationKey]! >= YellPay.maxAttempts {
-                        YellPay.crashedOperations.insert(operationKey)
+                    self.runOnMain {
+                        guard call.fail() else { return }
+                        
+                        print("💥 YellPay.getNotification - Exception: \(error)")
+                        reject("GET_NOTIFICATION_EXCEPTION", "Exception: \(error.localizedDescription)", error)
                     }
-                    
-                    print("💥 YellPay.getNotification - Exception: \(error)")
-                    reject("GET_NOTIFICATION_EXCEPTION", "Exception: \(error.localizedDescription)", error)
                 }
             }
         }
     }
     
+    /// Fetches only notifications newer than the stored watermark and appends them
+    /// to the local store. Resolves counts only; use getStoredNotifications to page.
+    @objc(syncNotifications:resolver:rejecter:)
+    func syncNotifications(_ userId: String, resolver resolve: @escaping RCTPromiseResolveBlock, rejecter reject: @escaping RCTPromiseRejectBlock) {
+        let safeUserId = sanitize(userId)
+        guard !safeUserId.isEmpty else {
+            reject("SYNC_NOTIFICATIONS_ERROR", "userId cannot be empty", nil)
+            return
+        }
+        
+        let store = YellPayNotificationStore.shared
+        let watermark = store.watermark(for: safeUserId)
+        
+        getNotification(safeUserId, lastUpdate: NSNumber(value: watermark), resolver: { result in
+            let response = result as? [String: Any] ?? [:]
+            let notifications = response["notifications"] as? [[String: Any]] ?? []
+            let lastUpdate = YellPayCore.int(response["lastUpdate"])
+            let (added, total) = store.append(safeUserId, notifications: notifications, lastUpdate: lastUpdate)
+            print("🔔 YellPay.syncNotifications - \(added) new, \(total) stored, watermark \(watermark) -> \(lastUpdate)")
+            resolve([
+                "added": added,
+                "total": total,
+                "lastUpdate": max(watermark, lastUpdate)
+            ])
+        }, rejecter: reject)
+    }
+    
+    @objc(getStoredNotifications:offset:limit:resolver:rejecter:)
+    func getStoredNotifications(_ userId: String, offset: NSNumber, limit: NSNumber, resolver resolve: @escaping RCTPromiseResolveBlock, rejecter reject: @escaping RCTPromiseRejectBlock) {
+        let safeUserId = sanitize(userId)
+        guard !safeUserId.isEmpty else {
+            reject("STORED_NOTIFICATIONS_ERROR", "userId cannot be empty", nil)
+            return
+        }
+        
+        let page = YellPayNotificationStore.shared.page(safeUserId, offset: offset.intValue, limit: limit.intValue)
+        resolve([
+            "total": page.total,
+            "lastUpdate": page.lastUpdate,
+            "notifications": page.notifications
+        ])
+    }
+    
+    /// Cursor-paged, filtered read of the local store; see YellPayNotificationStore.query.
+    @objc(queryStoredNotifications:query:resolver:rejecter:)
+    func queryStoredNotifications(_ userId: String, query: NSDictionary, resolver resolve: @escaping RCTPromiseResolveBlock, rejecter reject: @escaping RCTPromiseRejectBlock) {
+        let safeUserId = sanitize(userId)
+        guard !safeUserId.isEmpty else {
+            reject("STORED_NOTIFICATIONS_ERROR", "userId cannot be empty", nil)
+            return
+        }
+        
+        let raw = query as? [String: Any] ?? [:]
+        let text: (String) -> String? = { key in
+            let value = YellPayCore.string(raw[key])
+            return value.isEmpty ? nil : value
+        }
+        let storeQuery = YellPayNotificationStore.Query(
+            cursor: raw["cursor"] is NSNumber ? YellPayCore.int(raw["cursor"]) : nil,
+            limit: max(1, raw["limit"] is NSNumber ? YellPayCore.int(raw["limit"]) : 20),
+            search: text("search"),
+            since: text("since"),
+            until: text("until")
+        )
+        let page = YellPayNotificationStore.shared.query(safeUserId, storeQuery)
+        resolve([
+            "total": page.total,
+            "nextCursor": page.nextCursor.map { $0 as Any } ?? NSNull(),
+            "notifications": page.notifications
+        ])
+    }
+    
     @objc(getInformation:infoType:resolver:rejecter:)
     func getInformation(_ userId: String, infoType: NSNumber, resolver resolve: @escaping RCTPromiseResolveBlock, rejecter reject: @escaping RCTPromiseRejectBlock) {
         let operationKey = "getInformation"
-        guard !YellPay.crashedOperations.contains(operationKey) else {
-            reject("GET_INFORMATION_CIRCUIT_BREAKER", "Get information operation has failed too many times", nil)
-            return
-        }
         
         // Input validation
         let safeUserId = sanitize(userId)
@@ -1536,89 +1627,345 @@ class YellPay: NSObject {
             return
         }
         
-        DispatchQueue.main.async { [weak self] in
+        guard let flight = singleFlight("getInformation|\(safeUserId)|\(infoType.intValue)", resolve: resolve, reject: reject) else { return }
+        let resolve = flight.resolve, reject = flight.reject
+        
+        // Only the flight leader reaches the SDK, so only it may take a half-open probe slot
+        guard YellPayCircuitBreaker.shared.allow(operationKey) else {
+            reject("GET_INFORMATION_CIRCUIT_BREAKER", "Get information operation has failed too many times", nil)
+            return
+        }
+        
+        YellPay.executionQueue(for: operationKey).async { [weak self] in
             guard let self = self else {
                 reject("GET_INFORMATION_ERROR", "Module deallocated", nil)
                 return
             }
             
-            var isCompleted = false
-            let timeoutWorkItem = DispatchWorkItem { [weak self] in
-                guard !isCompleted, let self = self else { return }
-                isCompleted = true
+            let call = YellPayCompletionEngine.shared.begin(operationKey, timeout: 30) { [weak self] in
+                guard let self = self else { return }
                 print("⏰ YellPay.getInformation - Operation timed out")
                 
-                if self.shouldBlockOperation(operationKey) {
-                    self.blockOperation(operationKey)
-                }
-                
                 reject("GET_INFORMATION_TIMEOUT", "Get information operation timed out", nil)
             }
             
-            DispatchQueue.main.asyncAfter(deadline: .now() + 30, execute: timeoutWorkItem)
-            
             autoreleasepool {
                 do {
                     RoutePay.callGetInformationUserId(
                         safeUserId,
                         lastUpdateNotification: infoType.intValue,
-                        callSuccess: { [weak self] informationCount, informationMeta1, informationList, meta2, meta3 in
-                            guard !isCompleted, let self = self else { return }
-                            isCompleted = true
-                            timeoutWorkItem.cancel()
-                            
-                            // Convert information array to serializable format
-                            var informationArray: [[String: Any]] = []
-                            if let infoList = informationList {
-                                for info in infoList {
-                                    if let infoDict = info as? [String: Any] {
-                                        informationArray.append([
-                                            "id": infoDict["informationId"] as? String ?? "",
-                                            "title": infoDict["title"] as? String ?? "",
-                                            "content": infoDict["content"] as? String ?? "",
-                                            "date": infoDict["date"] as? String ?? ""
-                                        ])
-                                    }
-                                }
+                        callSuccess: { [weak self] userInfo, alert, bannerInformation, lastUpdateNotification, notifications in
+                            self?.decodeThenComplete(operationKey, {
+                                YellPayCore.InformationResponse(
+                                    userInfo: userInfo,
+                                    alert: alert,
+                                    bannerInformation: bannerInformation,
+                                    lastUpdate: lastUpdateNotification,
+                                    notifications: notifications
+                                ).bridgeValue
+                            }) { response in
+                                guard call.complete() else { return }
+                                
+                                resolve(response)
                             }
-                            
-                            resolve([
-                                "count": informationCount,
-                                "information": informationArray
-                            ])
                         },
                         callFailed: { [weak self] errorCode, errorMessage in
-                            guard !isCompleted, let self = self else { return }
-                            isCompleted = true
-                            timeoutWorkItem.cancel()
-                            
-                            YellPay.operationAttempts[operationKey] = (YellPay.operationAttempts[operationKey] ?? 0) + 1
-                            if YellPay.operationAttempts[operationKey]! >= YellPay.maxAttempts {
-                                YellPay.crashedOperations.insert(operationKey)
+                            self?.runOnMain {
+                                guard call.fail() else { return }
+                                
+                                reject("GET_INFORMATION_ERROR", "Error \(errorCode): \(errorMessage)", nil)
                             }
-                            
-                            reject("GET_INFORMATION_ERROR", "Error \(errorCode): \(errorMessage)", nil)
                         }
                     )
                 } catch {
-                    guard !isCompleted else { return }
-                    isCompleted = true
-                    timeoutWorkItem.cancel()
-                    
-                    YellPay.operationAttempts[operationKey] = (YellPay.operationAttempts[operationKey] ?? 0) + 1
-                    if YellPay.operationAttempts[operationKey]! >= YellPay.maxAttempts {
-                        YellPay.crashedOperations.insert(operationKey)
+                    self.runOnMain {
+                        guard call.fail() else { return }
+                        
+                        print("💥 YellPay.getInformation - Exception: \(error)")
+                        reject("GET_INFORMATION_EXCEPTION", "Exception: \(error.localizedDescription)", error)
                     }
-                    
-                    print("💥 YellPay.getInformation - Exception: \(error)")
-                    reject("GET_INFORMATION_EXCEPTION", "Exception: \(error.localizedDescription)", error)
                 }
             }
         }
     }
     
+    @objc(getConfirmLimitAmount:resolver:rejecter:)
+    func getConfirmLimitAmount(_ userId: String, resolver resolve: @escaping RCTPromiseResolveBlock, rejecter reject: @escaping RCTPromiseRejectBlock) {
+        let operationKey = "getConfirmLimitAmount"
+
+        // Input validation
+        let safeUserId = sanitize(userId)
+        guard !safeUserId.isEmpty else {
+            reject("GET_LIMIT_AMOUNT_ERROR", "userId cannot be empty", nil)
+            return
+        }
+        
+        guard let flight = singleFlight("getConfirmLimitAmount|\(safeUserId)", resolve: resolve, reject: reject) else { return }
+        let resolve = flight.resolve, reject = flight.reject
+        
+        // Only the flight leader reaches the SDK, so only it may take a half-open probe slot
+        guard YellPayCircuitBreaker.shared.allow(operationKey) else {
+            reject("GET_LIMIT_AMOUNT_CIRCUIT_BREAKER", "Get limit amount operation has failed too many times", nil)
+            return
+        }
+
+        YellPay.executionQueue(for: operationKey).async { [weak self] in
+            guard let self = self else {
+                reject("GET_LIMIT_AMOUNT_ERROR", "Module deallocated", nil)
+                return
+            }
+
+            let call = YellPayCompletionEngine.shared.begin(operationKey, timeout: 30) { [weak self] in
+                guard let self = self else { return }
+                print("⏰ YellPay.getConfirmLimitAmount - Operation timed out")
+
+                reject("GET_LIMIT_AMOUNT_TIMEOUT", "Get limit amount operation timed out", nil)
+            }
+
+            autoreleasepool {
+                RoutePay.callGetConfirmLimitAmountUserId(
+                    safeUserId,
+                    environmentMode: EnvironmentModeEnum.production,
+                    callSuccess: { [weak self] userInfo, alert in
+                        self?.decodeThenComplete(operationKey, {
+                            YellPayCore.ConfirmLimitAmountResponse(userInfo: userInfo, alert: alert).bridgeValue
+                        }) { response in
+                            guard call.complete() else { return }
+                            resolve(response)
+                        }
+                    },
+                    callFailed: { [weak self] errorCode, errorMessage in
+                        self?.runOnMain {
+                            guard call.fail() else { return }
+
+                            reject("GET_LIMIT_AMOUNT_ERROR", "Error \(errorCode): \(errorMessage)", nil)
+                        }
+                    }
+                )
+            }
+        }
+    }
+
+    // MARK: - Cancellable Requests
+
+    // Async reads started by `request`, keyed by method + arguments. This table is separate
+    // from the direct methods' single-flight table, so cancelling a request never touches a
+    // direct call from another screen. Each flight runs one Task and settles every requestId
+    // attached to it. Main thread only.
+    private struct RequestFlight {
+        let token: UUID
+        let task: Task<Void, Never>
+        var waiters: [(requestId: String, blocks: PromiseBlocks)]
+    }
+    private static var requestFlights: [String: RequestFlight] = [:]
+    // Flight key each running requestId is attached to. Main thread only.
+    private static var requestFlightKeys: [String: String] = [:]
+
+    /// Runs a read-only SDK call through YellPayAsync under a caller-chosen requestId so a
+    /// screen that goes away can abandon it with `cancelRequest`. Supports the batchable methods.
+    /// A repeat of a request that is still running (e.g. pull-to-refresh during the initial
+    /// load) joins it under its own requestId.
+    @objc
+    func request(_ method: String, userId: String, lastUpdate: NSNumber, requestId: String, resolver resolve: @escaping RCTPromiseResolveBlock, rejecter reject: @escaping RCTPromiseRejectBlock) {
+        let safeUserId = sanitize(userId, maxLength: 128)
+        let safeRequestId = sanitize(requestId, maxLength: 128)
+        guard !safeUserId.isEmpty, !safeRequestId.isEmpty else {
+            reject("REQUEST_ERROR", "userId and requestId are required", nil)
+            return
+        }
+        guard YellPay.batchableMethods.contains(method) else {
+            reject("REQUEST_ERROR", "Unsupported method: \(method)", nil)
+            return
+        }
+
+        let flightKey: String
+        switch method {
+        case "getNotification", "getInformation":
+            flightKey = "\(method)|\(safeUserId)|\(lastUpdate.intValue)"
+        default:
+            flightKey = "\(method)|\(safeUserId)"
+        }
+
+        runOnMain {
+            // Reusing a requestId for a different call abandons the earlier one
+            if let previousKey = YellPay.requestFlightKeys[safeRequestId], previousKey != flightKey {
+                self.detachRequest(safeRequestId)
+            }
+            YellPay.requestFlightKeys[safeRequestId] = flightKey
+            if YellPay.requestFlights[flightKey] != nil {
+                YellPay.requestFlights[flightKey]?.waiters.append((safeRequestId, (resolve, reject)))
+                print("🔗 YellPay - Joined in-flight request \(method)")
+                return
+            }
+
+            let token = UUID()
+            let task = Task {
+                let settle: (PromiseBlocks) -> Void
+                do {
+                    let value: Any
+                    switch method {
+                    case "getUserInfo":
+                        value = try await YellPayAsync.userInfo(safeUserId).map { $0.bridgeValue }
+                    case "getNotification":
+                        let result = try await YellPayAsync.notifications(safeUserId, lastUpdate: lastUpdate.intValue)
+                        value = [
+                            "count": result.lastUpdate,
+                            "lastUpdate": result.lastUpdate,
+                            "notifications": result.notifications.map { $0.bridgeValue }
+                        ]
+                    case "getInformation":
+                        value = try await YellPayAsync.information(safeUserId, lastUpdate: lastUpdate.intValue).bridgeValue
+                    default:
+                        value = try await YellPayAsync.confirmLimitAmount(safeUserId).bridgeValue
+                    }
+                    settle = { $0.resolve(value) }
+                } catch is CancellationError {
+                    settle = { $0.reject("REQUEST_CANCELLED", "\(method) was cancelled", nil) }
+                } catch is YellPayAsync.TimeoutError {
+                    settle = { $0.reject("REQUEST_TIMEOUT", "\(method) timed out", nil) }
+                } catch is YellPayAsync.CircuitOpenError {
+                    settle = { $0.reject("REQUEST_CIRCUIT_BREAKER", "\(method) has failed too many times", nil) }
+                } catch {
+                    settle = { $0.reject("REQUEST_ERROR", error.localizedDescription, error) }
+                }
+                DispatchQueue.main.async {
+                    // A flight whose callers all cancelled was already removed (and may have been replaced)
+                    guard YellPay.requestFlights[flightKey]?.token == token,
+                          let flight = YellPay.requestFlights.removeValue(forKey: flightKey) else { return }
+                    for waiter in flight.waiters {
+                        if YellPay.requestFlightKeys[waiter.requestId] == flightKey {
+                            YellPay.requestFlightKeys.removeValue(forKey: waiter.requestId)
+                        }
+                        settle(waiter.blocks)
+                    }
+                }
+            }
+            YellPay.requestFlights[flightKey] = RequestFlight(token: token, task: task, waiters: [(safeRequestId, (resolve, reject))])
+        }
+    }
+
+    /// Rejects every caller attached under `requestId` with REQUEST_CANCELLED. The shared Task is
+    /// cancelled only once no other requestId is waiting on it. Main thread only.
+    @discardableResult
+    private func detachRequest(_ requestId: String) -> Bool {
+        guard let flightKey = YellPay.requestFlightKeys.removeValue(forKey: requestId),
+              var flight = YellPay.requestFlights[flightKey] else { return false }
+        let detached = flight.waiters.filter { $0.requestId == requestId }
+        flight.waiters.removeAll { $0.requestId == requestId }
+        if flight.waiters.isEmpty {
+            flight.task.cancel()
+            YellPay.requestFlights.removeValue(forKey: flightKey)
+        } else {
+            YellPay.requestFlights[flightKey] = flight
+        }
+        let method = flightKey.split(separator: "|").first.map(String.init) ?? "request"
+        detached.forEach { $0.blocks.reject("REQUEST_CANCELLED", "\(method) was cancelled", nil) }
+        return !detached.isEmpty
+    }
+
+    /// Cancels a pending `request`; its promise rejects with REQUEST_CANCELLED.
+    /// Resolves false when no request with that id is running.
+    @objc
+    func cancelRequest(_ requestId: String, resolver resolve: @escaping RCTPromiseResolveBlock, rejecter reject: @escaping RCTPromiseRejectBlock) {
+        runOnMain {
+            resolve(self.detachRequest(self.sanitize(requestId, maxLength: 128)))
+        }
+    }
+
+    // MARK: - Batch Methods
+
+    // Read-only calls that can be coalesced into a single bridge round trip
+    private static let batchableMethods: Set<String> = ["getUserInfo", "getInformation", "getNotification", "getConfirmLimitAmount"]
+
+    /// Runs several read-only SDK calls concurrently and resolves once with one
+    /// entry per operation, in request order: `{ method, ok, result }` on success or
+    /// `{ method, ok: false, code, message }` on failure. A failing entry never
+    /// rejects the whole batch.
+    @objc(batch:resolver:rejecter:)
+    func batch(_ operations: [[String: Any]], resolver resolve: @escaping RCTPromiseResolveBlock, rejecter reject: @escaping RCTPromiseRejectBlock) {
+        guard !operations.isEmpty else {
+            resolve([])
+            return
+        }
+
+        let group = DispatchGroup()
+        let lock = NSLock()
+        var results = [[String: Any]?](repeating: nil, count: operations.count)
+
+        // Each entry completes exactly once even if the SDK calls back late after a timeout
+        func complete(_ index: Int, _ entry: [String: Any]) {
+            lock.lock()
+            guard results[index] == nil else {
+                lock.unlock()
+                return
+            }
+            results[index] = entry
+            lock.unlock()
+            group.leave()
+        }
+
+        for (index, operation) in operations.enumerated() {
+            let method = YellPayCore.string(operation["method"])
+            let userId = YellPayCore.string(operation["userId"])
+            let lastUpdate = NSNumber(value: YellPayCore.int(operation["lastUpdate"]))
+
+            group.enter()
+            let onResolve: RCTPromiseResolveBlock = { value in
+                complete(index, ["method": method, "ok": true, "result": value ?? NSNull()])
+            }
+            let onReject: RCTPromiseRejectBlock = { code, message, _ in
+                complete(index, ["method": method, "ok": false, "code": code ?? "BATCH_ERROR", "message": message ?? ""])
+            }
+
+            guard YellPay.batchableMethods.contains(method) else {
+                onReject("BATCH_UNSUPPORTED_METHOD", "Method '\(method)' cannot be batched", nil)
+                continue
+            }
+
+            switch method {
+            case "getUserInfo":
+                getUserInfo(userId, resolver: onResolve, rejecter: onReject)
+            case "getInformation":
+                getInformation(userId, infoType: lastUpdate, resolver: onResolve, rejecter: onReject)
+            case "getNotification":
+                getNotification(userId, lastUpdate: lastUpdate, resolver: onResolve, rejecter: onReject)
+            default:
+                getConfirmLimitAmount(userId, resolver: onResolve, rejecter: onReject)
+            }
+        }
+
+        group.notify(queue: .main) {
+            resolve(results.map { $0 ?? [:] })
+        }
+    }
+
+    // MARK: - Card Image Methods
+
+    /// Renders (or loads from cache) every card face in one pass and resolves
+    /// `[{ uri }]` in input order; `uri` is null when the SDK produced no image.
+    @objc(renderCardImages:scale:resolver:rejecter:)
+    func renderCardImages(_ cards: [[String: Any]], scale: NSNumber, resolver resolve: @escaping RCTPromiseResolveBlock, rejecter reject: @escaping RCTPromiseRejectBlock) {
+        let faces = cards.map { card in
+            YellPayCardImageCache.CardFace(
+                cardNumber: sanitize(YellPayCore.string(card["cardNumber"]), maxLength: 32, allowed: CharacterSet(charactersIn: "0123456789* ")),
+                expiryDate: sanitize(YellPayCore.string(card["expiryDate"]), maxLength: 8, allowed: CharacterSet(charactersIn: "0123456789/"))
+            )
+        }
+        let renderScale = scale.doubleValue > 0 ? CGFloat(scale.doubleValue) : UIScreen.main.scale
+
+        YellPayCardImageCache.shared.render(faces, scale: renderScale) { uris in
+            resolve(uris.map { ["uri": $0 ?? NSNull()] })
+        }
+    }
+
+    @objc
+    func clearCardImageCache(_ resolve: @escaping RCTPromiseResolveBlock, rejecter reject: @escaping RCTPromiseRejectBlock) {
+        YellPayCardImageCache.shared.clear()
+        resolve(true)
+    }
+
     // MARK: - Helper Methods
-    
+
     @objc
     func checkFrameworkAvailability(_ resolve: @escaping RCTPromiseResolveBlock, rejecter reject: @escaping RCTPromiseRejectBlock) {
         // Check if RouteCode framework classes are available
@@ -1644,18 +1991,6 @@ class YellPay: NSObject {
         let operationName = "validateAuthenticationStatus"
         print("🔥 YellPay.\(operationName) START")
         
-        // Circuit breaker check
-        if isOperationBlocked(operationName) {
-            print("🚫 Operation \(operationName) blocked due to previous crashes")
-            resolve([
-                "authenticated": false,
-                "error": "Operation blocked due to previous crashes"
-            ])
-            return
-        }
-        
-        incrementAttempt(operationName)
-        
         // Much shorter timeout for validation
         DispatchQueue.main.async { [weak self] in
             guard let self = self else {
@@ -1666,31 +2001,31 @@ class YellPay: NSObject {
                 return
             }
             
-            var isCompleted = false
+            // Circuit breaker check
+            guard YellPayCircuitBreaker.shared.allow(operationName) else {
+                print("🚫 Operation \(operationName) blocked while its circuit is open")
+                resolve([
+                    "authenticated": false,
+                    "error": "Operation blocked due to previous crashes"
+                ])
+                return
+            }
             
             // Very short timeout to prevent hangs
-            let timeoutWorkItem = DispatchWorkItem { [weak self] in
-                guard !isCompleted, let self = self else { return }
-                isCompleted = true
+            let call = YellPayCompletionEngine.shared.begin(operationName, timeout: 3) { [weak self] in
+                guard let self = self else { return }
                 print("⏰ YellPay.\(operationName) - Validation timed out quickly")
                 
-                if self.shouldBlockOperation(operationName) {
-                    self.blockOperation(operationName)
-                }
-                
                 resolve([
                     "authenticated": false,
                     "error": "Validation timed out (3s)"
                 ])
             }
             
-            DispatchQueue.main.asyncAfter(deadline: .now() + 3, execute: timeoutWorkItem)
-            
             // Try a very basic check first - just see if RouteAuth exists
             do {
                 guard NSClassFromString("RouteAuth") != nil else {
-                    timeoutWorkItem.cancel()
-                    isCompleted = true
+                    guard call.complete() else { return }
                     resolve([
                         "authenticated": false,
                         "error": "RouteAuth framework not available"
@@ -1699,8 +2034,7 @@ class YellPay: NSObject {
                 }
                 
                 // Skip the potentially problematic SDK call for now
-                timeoutWorkItem.cancel()
-                isCompleted = true
+                guard call.complete() else { return }
                 print("✅ YellPay.\(operationName) - Basic framework check passed")
                 resolve([
                     "authenticated": false,
@@ -1708,15 +2042,9 @@ class YellPay: NSObject {
                 ])
                 
             } catch {
-                guard !isCompleted else { return }
-                isCompleted = true
-                timeoutWorkItem.cancel()
+                guard call.fail() else { return }
                 print("💥 YellPay.\(operationName) - Exception: \(error)")
                 
-                if self.shouldBlockOperation(operationName) {
-                    self.blockOperation(operationName)
-                }
-                
                 resolve([
                     "authenticated": false,
                     "error": "Framework check failed: \(error.localizedDescription)"
@@ -1727,8 +2055,7 @@ class YellPay: NSObject {
     
     @objc
     func resetCrashProtection(_ resolve: @escaping RCTPromiseResolveBlock, rejecter reject: @escaping RCTPromiseRejectBlock) {
-        YellPay.crashedOperations.removeAll()
-        YellPay.operationAttempts.removeAll()
+        YellPayCircuitBreaker.shared.reset()
         print("🔄 Crash protection reset - all operations unblocked")
         resolve([
             "reset": true,
@@ -1738,10 +2065,33 @@ class YellPay: NSObject {
     
     @objc
     func getCrashProtectionStatus(_ resolve: @escaping RCTPromiseResolveBlock, rejecter reject: @escaping RCTPromiseRejectBlock) {
-        resolve([
-            "blockedOperations": Array(YellPay.crashedOperations),
-            "operationAttempts": YellPay.operationAttempts
-        ])
+        resolve(YellPayCircuitBreaker.shared.status())
+    }
+    
+    @objc
+    func configureCircuitBreaker(_ spec: NSDictionary, resolver resolve: @escaping RCTPromiseResolveBlock, rejecter reject: @escaping RCTPromiseRejectBlock) {
+        guard let raw = spec as? [String: Any] else {
+            reject("CIRCUIT_BREAKER_ERROR", "Invalid circuit breaker spec", nil)
+            return
+        }
+        YellPayCircuitBreaker.shared.configure(YellPayCircuitBreaker.Spec(raw))
+        resolve(["configured": true])
+    }
+    
+    // MARK: - Metrics Methods
+    
+    @objc
+    func getMetricsSnapshot(_ resolve: @escaping RCTPromiseResolveBlock, rejecter reject: @escaping RCTPromiseRejectBlock) {
+        var snapshot = YellPayMetrics.shared.snapshot()
+        snapshot.merge(YellPayCircuitBreaker.shared.status()) { current, _ in current }
+        snapshot["pendingCalls"] = YellPayCompletionEngine.shared.pendingCount
+        resolve(snapshot)
+    }
+    
+    @objc
+    func resetMetrics(_ resolve: @escaping RCTPromiseResolveBlock, rejecter reject: @escaping RCTPromiseRejectBlock) {
+        YellPayMetrics.shared.reset()
+        resolve(["reset": true])
     }
     
     private func getCurrentViewController() -> UIViewController? {
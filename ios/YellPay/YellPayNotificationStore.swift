@@ -0,0 +1,144 @@
+import Foundation
+
+// Append-only, per-user notification store persisted under Application Support.
+// Sync only asks the SDK for entries newer than the stored lastUpdateNotification
+// watermark; screens page through the local copy instead of re-bridging the
+// whole history on every open.
+final class YellPayNotificationStore {
+
+    static let shared = YellPayNotificationStore()
+
+    struct Snapshot: Codable {
+        var lastUpdate: Int = 0
+        var notifications: [[String: String]] = []
+    }
+
+    /// Filters for `query`. Dates compare as strings against each entry's `date`,
+    /// so pass them in the SDK's own (year-first) format.
+    struct Query {
+        var cursor: Int?
+        var limit: Int
+        var search: String?
+        var since: String?
+        var until: String?
+    }
+
+    private let queue = DispatchQueue(label: "com.yellpay.notification-store")
+    private var cache: [String: Snapshot] = [:]
+    // Lower-cased text of each stored entry, parallel to Snapshot.notifications; built on first query
+    private var searchIndex: [String: [String]] = [:]
+
+    private init() {}
+
+    private func fileURL(for userId: String) -> URL? {
+        guard let base = FileManager.default.urls(for: .applicationSupportDirectory, in: .userDomainMask).first else {
+            return nil
+        }
+        let directory = base.appendingPathComponent("YellPay/notifications", isDirectory: true)
+        try? FileManager.default.createDirectory(at: directory, withIntermediateDirectories: true)
+        return directory.appendingPathComponent("\(userId).json")
+    }
+
+    // Must be called on `queue`
+    private func load(_ userId: String) -> Snapshot {
+        if let cached = cache[userId] {
+            return cached
+        }
+        var snapshot = Snapshot()
+        if let url = fileURL(for: userId),
+           let data = try? Data(contentsOf: url),
+           let decoded = try? JSONDecoder().decode(Snapshot.self, from: data) {
+            snapshot = decoded
+        }
+        cache[userId] = snapshot
+        return snapshot
+    }
+
+    func watermark(for userId: String) -> Int {
+        return queue.sync { load(userId).lastUpdate }
+    }
+
+    /// Appends entries not seen before and advances the watermark.
+    /// Returns the number of new entries and the new total.
+    func append(_ userId: String, notifications: [[String: Any]], lastUpdate: Int) -> (added: Int, total: Int) {
+        return queue.sync {
+            var snapshot = load(userId)
+            var known = Set(snapshot.notifications.compactMap { $0["id"] })
+            var added = 0
+            for notification in notifications {
+                let entry = notification.mapValues { YellPayCore.string($0) }
+                let id = entry["id"] ?? ""
+                if !id.isEmpty {
+                    guard !known.contains(id) else { continue }
+                    known.insert(id)
+                }
+                snapshot.notifications.append(entry)
+                added += 1
+            }
+            snapshot.lastUpdate = max(snapshot.lastUpdate, lastUpdate)
+            cache[userId] = snapshot
+            if searchIndex[userId] != nil {
+                searchIndex[userId]! += snapshot.notifications.suffix(added).map(searchText)
+            }
+
+            if let url = fileURL(for: userId), let data = try? JSONEncoder().encode(snapshot) {
+                do {
+                    try data.write(to: url, options: .atomic)
+                } catch {
+                    print("💥 YellPayNotificationStore - Failed to persist: \(error)")
+                }
+            }
+            return (added, snapshot.notifications.count)
+        }
+    }
+
+    /// Newest-first page of the stored notifications.
+    func page(_ userId: String, offset: Int, limit: Int) -> (notifications: [[String: String]], total: Int, lastUpdate: Int) {
+        return queue.sync {
+            let snapshot = load(userId)
+            let total = snapshot.notifications.count
+            let start = max(0, offset)
+            guard start < total, limit > 0 else { return ([], total, snapshot.lastUpdate) }
+            let end = min(total, start + limit)
+            let page = snapshot.notifications[(total - end)..<(total - start)].reversed()
+            return (Array(page), total, snapshot.lastUpdate)
+        }
+    }
+
+    private func searchText(_ entry: [String: String]) -> String {
+        return entry.values.joined(separator: "\n").lowercased()
+    }
+
+    /// Newest-first page that starts just below `cursor` (a position in the append-only
+    /// list), so pages stay stable while syncs append. `nextCursor` is nil at the end.
+    func query(_ userId: String, _ query: Query) -> (notifications: [[String: String]], nextCursor: Int?, total: Int) {
+        return queue.sync {
+            let snapshot = load(userId)
+            let total = snapshot.notifications.count
+            let needle = query.search?.trimmingCharacters(in: .whitespacesAndNewlines).lowercased() ?? ""
+            var index: [String] = []
+            if !needle.isEmpty {
+                if searchIndex[userId] == nil {
+                    searchIndex[userId] = snapshot.notifications.map(searchText)
+                }
+                index = searchIndex[userId]!
+            }
+
+            var results: [[String: String]] = []
+            var position = min(total, max(0, query.cursor ?? total))
+            while position > 0 && results.count < query.limit {
+                position -= 1
+                let entry = snapshot.notifications[position]
+                if !needle.isEmpty && !index[position].contains(needle) { continue }
+                if query.since != nil || query.until != nil {
+                    guard let date = entry["date"], !date.isEmpty else { continue }
+                    if let since = query.since, date < since { continue }
+                    // `until` is inclusive: a bare day also matches times on that day
+                    if let until = query.until, date > until, !date.hasPrefix(until) { continue }
+                }
+                results.append(entry)
+            }
+            return (results, position > 0 ? position : nil, total)
+        }
+    }
+}
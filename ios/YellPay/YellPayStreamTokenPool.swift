@@ -0,0 +1,81 @@
+import Foundation
+
+// Small pool of stream seed/time pairs for RoutePay.callPaymentSchemeUuid. Seeds are
+// issued outside the app (merchant backend or deep link), so JS hands them over
+// ahead of time and a scheme launch takes one from here instead of waiting on a
+// fetch. Entries expire by their streamTime; the freshest valid one is handed out
+// first and each entry is used at most once.
+final class YellPayStreamTokenPool {
+
+    static let shared = YellPayStreamTokenPool()
+
+    struct Token {
+        let seed: String
+        let time: Int
+    }
+
+    // SDK streamTime is epoch seconds; larger values are taken as milliseconds
+    private static let millisecondThreshold = 100_000_000_000
+
+    private let lock = NSLock()
+    private var tokens: [Token] = []   // sorted by time, oldest first
+    private var capacity = 8
+    private var maxAge: TimeInterval = 120
+
+    private init() {}
+
+    func configure(capacity: Int, maxAge: TimeInterval) {
+        lock.lock()
+        defer { lock.unlock() }
+        self.capacity = max(1, capacity)
+        self.maxAge = max(1, maxAge)
+        trim(now: Date().timeIntervalSince1970)
+    }
+
+    private static func seconds(_ streamTime: Int) -> TimeInterval {
+        return streamTime >= millisecondThreshold ? TimeInterval(streamTime) / 1000 : TimeInterval(streamTime)
+    }
+
+    // Must hold lock
+    private func trim(now: TimeInterval) {
+        let cutoff = now - maxAge
+        if let firstValid = tokens.firstIndex(where: { YellPayStreamTokenPool.seconds($0.time) >= cutoff }) {
+            tokens.removeFirst(firstValid)
+        } else {
+            tokens.removeAll()
+        }
+        if tokens.count > capacity {
+            tokens.removeFirst(tokens.count - capacity)
+        }
+    }
+
+    /// Adds tokens that are not expired or already pooled. Returns the pool size.
+    @discardableResult
+    func add(_ newTokens: [Token]) -> Int {
+        lock.lock()
+        defer { lock.unlock() }
+        let now = Date().timeIntervalSince1970
+        var seeds = Set(tokens.map { $0.seed })
+        for token in newTokens where !token.seed.isEmpty && seeds.insert(token.seed).inserted {
+            let index = tokens.firstIndex { $0.time > token.time } ?? tokens.endIndex
+            tokens.insert(token, at: index)
+        }
+        trim(now: now)
+        return tokens.count
+    }
+
+    /// Removes and returns the freshest unexpired token.
+    func take() -> Token? {
+        lock.lock()
+        defer { lock.unlock() }
+        trim(now: Date().timeIntervalSince1970)
+        return tokens.popLast()
+    }
+
+    var count: Int {
+        lock.lock()
+        defer { lock.unlock() }
+        trim(now: Date().timeIntervalSince1970)
+        return tokens.count
+    }
+}
@@ -0,0 +1,153 @@
+// Minimal CBOR (RFC 8949) encoder for JSON-shaped values, so clients that send
+// `Accept: application/cbor` get a smaller body that decodes without text parsing.
+// Covers what JSON.stringify would emit: objects, arrays, strings, numbers,
+// booleans and null. Buffers become byte strings; Dates become ISO strings.
+
+export const CBOR_CONTENT_TYPE = 'application/cbor';
+
+const MAJOR_UINT = 0;
+const MAJOR_NEGINT = 1;
+const MAJOR_BYTES = 2;
+const MAJOR_TEXT = 3;
+const MAJOR_ARRAY = 4;
+const MAJOR_MAP = 5;
+
+const SIMPLE_FALSE = 0xf4;
+const SIMPLE_TRUE = 0xf5;
+const SIMPLE_NULL = 0xf6;
+const FLOAT32 = 0xfa;
+const FLOAT64 = 0xfb;
+
+class Writer {
+  constructor(initialSize = 1024) {
+    this.buffer = Buffer.allocUnsafe(initialSize);
+    this.length = 0;
+  }
+
+  reserve(bytes) {
+    if (this.length + bytes <= this.buffer.length) return;
+    const next = Buffer.allocUnsafe(Math.max(this.buffer.length * 2, this.length + bytes));
+    this.buffer.copy(next, 0, 0, this.length);
+    this.buffer = next;
+  }
+
+  byte(value) {
+    this.reserve(1);
+    this.buffer[this.length++] = value;
+  }
+
+  // Major type + argument, using the shortest encoding for the argument
+  head(major, value) {
+    const type = major << 5;
+    if (value < 24) {
+      this.byte(type | value);
+    } else if (value < 0x100) {
+      this.reserve(2);
+      this.buffer[this.length++] = type | 24;
+      this.buffer[this.length++] = value;
+    } else if (value < 0x10000) {
+      this.reserve(3);
+      this.buffer[this.length++] = type | 25;
+      this.buffer.writeUInt16BE(value, this.length);
+      this.length += 2;
+    } else if (value < 0x100000000) {
+      this.reserve(5);
+      this.buffer[this.length++] = type | 26;
+      this.buffer.writeUInt32BE(value, this.length);
+      this.length += 4;
+    } else {
+      this.reserve(9);
+      this.buffer[this.length++] = type | 27;
+      this.buffer.writeBigUInt64BE(BigInt(value), this.length);
+      this.length += 8;
+    }
+  }
+
+  bytes(source) {
+    this.reserve(source.length);
+    Buffer.from(source.buffer, source.byteOffset, source.length).copy(this.buffer, this.length);
+    this.length += source.length;
+  }
+
+  text(value) {
+    const size = Buffer.byteLength(value, 'utf8');
+    this.head(MAJOR_TEXT, size);
+    this.reserve(size);
+    this.buffer.write(value, this.length, size, 'utf8');
+    this.length += size;
+  }
+
+  number(value) {
+    if (Number.isSafeInteger(value)) {
+      if (value >= 0) this.head(MAJOR_UINT, value);
+      else this.head(MAJOR_NEGINT, -1 - value);
+      return;
+    }
+    if (!Number.isFinite(value)) {
+      // JSON.stringify turns NaN/Infinity into null
+      this.byte(SIMPLE_NULL);
+      return;
+    }
+    if (Math.fround(value) === value) {
+      this.reserve(5);
+      this.buffer[this.length++] = FLOAT32;
+      this.buffer.writeFloatBE(value, this.length);
+      this.length += 4;
+      return;
+    }
+    this.reserve(9);
+    this.buffer[this.length++] = FLOAT64;
+    this.buffer.writeDoubleBE(value, this.length);
+    this.length += 8;
+  }
+
+  value(value) {
+    if (value === null || value === undefined) {
+      this.byte(SIMPLE_NULL);
+      return;
+    }
+    switch (typeof value) {
+      case 'string':
+        this.text(value);
+        return;
+      case 'number':
+        this.number(value);
+        return;
+      case 'boolean':
+        this.byte(value ? SIMPLE_TRUE : SIMPLE_FALSE);
+        return;
+      case 'bigint':
+        this.number(Number(value));
+        return;
+      default:
+        break;
+    }
+    if (value instanceof Uint8Array) {
+      this.head(MAJOR_BYTES, value.length);
+      this.bytes(value);
+      return;
+    }
+    if (value instanceof Date) {
+      this.text(value.toISOString());
+      return;
+    }
+    if (Array.isArray(value)) {
+      this.head(MAJOR_ARRAY, value.length);
+      for (const item of value) this.value(item);
+      return;
+    }
+    // Plain object: skip undefined/function members the way JSON.stringify does
+    const entries = Object.entries(value).filter(([, v]) => v !== undefined && typeof v !== 'function');
+    this.head(MAJOR_MAP, entries.length);
+    for (const [key, item] of entries) {
+      this.text(key);
+      this.value(item);
+    }
+  }
+}
+
+export function encodeCbor(value) {
+  const writer = new Writer();
+  writer.value(value);
+  return writer.buffer.subarray(0, writer.length);
+}
@@ -3,7 +3,8 @@ import express from 'express';
 import morgan from 'morgan';
 import path from 'path';
 import { fileURLToPath } from 'url';
-import { ensureDataInitialized, getGlobalSummary, getRegionData, getRegions, scheduleTrendUpdates } from './trends.js';
+import { CBOR_CONTENT_TYPE, encodeCbor } from './cbor.js';
+import { ensureDataInitialized, getGlobalSummaryPayload, getRegionData, getRegions, scheduleTrendUpdates } from './trends.js';
 
 const __filename = fileURLToPath(import.meta.url);
 const __dirname = path.dirname(__filename);
@@ -18,14 +19,28 @@ app.use(morgan('dev'));
 // Static admin assets
 app.use('/public', express.static(path.join(__dirname, 'public')));
 
+// JSON unless the client prefers CBOR in its Accept header
+function wantsCbor(req) {
+  return req.accepts(['application/json', CBOR_CONTENT_TYPE]) === CBOR_CONTENT_TYPE;
+}
+
+function sendNegotiated(req, res, value) {
+  res.vary('Accept');
+  if (wantsCbor(req)) {
+    res.type(CBOR_CONTENT_TYPE).send(encodeCbor(value));
+    return;
+  }
+  res.json(value);
+}
+
 // Health
 app.get('/health', (_req, res) => {
   res.json({ status: 'ok' });
 });
 
 // Regions list
-app.get('/api/trends/regions', (_req, res) => {
-  res.json({ regions: getRegions() });
+app.get('/api/trends/regions', (req, res) => {
+  sendNegotiated(req, res, { regions: getRegions() });
 });
 
 // Top topics/keywords for a region
@@ -36,12 +51,22 @@ app.get('/api/trends/top', (req, res) => {
     res.status(404).json({ error: `Region ${region} not found` });
     return;
   }
-  res.json({ region, updatedAt: data.updatedAt, top: data.top });
+  sendNegotiated(req, res, { region, updatedAt: data.updatedAt, top: data.top });
 });
 
-// Global summary across regions
-app.get('/api/trends/summary', (_req, res) => {
-  res.json(getGlobalSummary());
+// Global summary across regions (precomputed on refresh; pollers get 304 until it changes)
+app.get('/api/trends/summary', (req, res) => {
+  const payload = getGlobalSummaryPayload();
+  const cbor = wantsCbor(req);
+  const { etag, body } = cbor ? payload.cbor : payload;
+  res.vary('Accept');
+  res.set('ETag', etag);
+  res.set('Cache-Control', 'no-cache');
+  if (req.fresh) {
+    res.status(304).end();
+    return;
+  }
+  res.type(cbor ? CBOR_CONTENT_TYPE : 'application/json').send(body);
 });
 
 // Simple admin page
@@ -0,0 +1,94 @@
+// Bounded-concurrency runner for per-region upstream fetches.
+// Each region gets its own timeout and jittered exponential backoff; results are
+// reported through onResult as soon as a region settles so callers can commit
+// partial progress instead of waiting for the slowest region.
+
+// Unset, blank or non-numeric values fall back; an explicit 0 (e.g. no retries) is kept
+function envNumber(name, fallback) {
+  const raw = process.env[name];
+  if (raw === undefined || raw.trim() === '') return fallback;
+  const value = Number(raw);
+  return Number.isNaN(value) ? fallback : value;
+}
+
+export const DEFAULT_FETCH_OPTIONS = {
+  concurrency: envNumber('TRENDS_FETCH_CONCURRENCY', 4),
+  timeoutMs: envNumber('TRENDS_FETCH_TIMEOUT_MS', 15000),
+  retries: envNumber('TRENDS_FETCH_RETRIES', 2),
+  backoffMs: 500,
+};
+
+const sleep = (ms) => new Promise((resolve) => setTimeout(resolve, ms));
+
+// Full jitter: uniform in [0, base * 2^attempt]
+function backoffDelay(baseMs, attempt) {
+  return Math.random() * baseMs * 2 ** attempt;
+}
+
+// One attempt: the signal is aborted on timeout so fetchRegion can cancel its upstream
+// request. The caller's worker slot stays taken until the attempt itself settles, so a
+// retry never runs beside an abandoned request and upstream concurrency stays bounded.
+async function attemptWithTimeout(region, fetchRegion, timeoutMs) {
+  const controller = new AbortController();
+  const attempt = Promise.resolve().then(() => fetchRegion(region, { signal: controller.signal }));
+  let timer;
+  const timeout = new Promise((_, reject) => {
+    timer = setTimeout(() => {
+      controller.abort();
+      reject(new Error(`Region ${region} timed out after ${timeoutMs}ms`));
+    }, timeoutMs);
+  });
+  try {
+    return await Promise.race([attempt, timeout]);
+  } catch (e) {
+    if (controller.signal.aborted) await attempt.catch(() => {});
+    throw e;
+  } finally {
+    clearTimeout(timer);
+  }
+}
+
+async function fetchWithRetry(region, fetchRegion, { timeoutMs, retries, backoffMs }) {
+  let lastError;
+  for (let attempt = 0; attempt <= retries; attempt += 1) {
+    try {
+      return await attemptWithTimeout(region, fetchRegion, timeoutMs);
+    } catch (e) {
+      lastError = e;
+      if (attempt < retries) await sleep(backoffDelay(backoffMs, attempt));
+    }
+  }
+  throw lastError;
+}
+
+/**
+ * Fetch every region with at most `concurrency` requests in flight, counting timed-out
+ * requests that have not settled yet. fetchRegion(region, { signal }) should stop its
+ * upstream request when `signal` aborts; one that ignores it holds its slot until it settles.
+ * onResult(region, error, value) is called once per region as it settles.
+ * Resolves to { succeeded: string[], failed: string[] }.
+ */
+export async function fetchRegions(regions, fetchRegion, onResult, options = {}) {
+  const opts = { ...DEFAULT_FETCH_OPTIONS, ...options };
+  const queue = regions.slice();
+  const succeeded = [];
+  const failed = [];
+
+  async function worker() {
+    while (queue.length > 0) {
+      const region = queue.shift();
+      try {
+        const value = await fetchWithRetry(region, fetchRegion, opts);
+        succeeded.push(region);
+        onResult(region, null, value);
+      } catch (e) {
+        failed.push(region);
+        onResult(region, e, null);
+      }
+    }
+  }
+
+  const workers = Array.from({ length: Math.max(1, Math.min(opts.concurrency, regions.length)) }, worker);
+  await Promise.all(workers);
+  return { succeeded, failed };
+}
@@ -0,0 +1,240 @@
+// Local stand-in for the RouteCode backends (auth.unid.net / dev-pay.unid.net).
+// In record mode every request is forwarded upstream and the response saved under
+// recordings/; in replay mode the saved response is served with an injected
+// network profile (latency, bandwidth, errors) driven by a seeded PRNG so runs
+// are repeatable. Recordings are matched on method, path and the request
+// parameters minus volatile fields (timestamps, nonces, signatures), so a replayed
+// SDK request finds the recording made from an earlier one. Point debug builds at
+// it with YellPay.setAuthDomainOverride().
+
+import crypto from 'crypto';
+import express from 'express';
+import fs from 'fs';
+import path from 'path';
+import { fileURLToPath } from 'url';
+
+const __filename = fileURLToPath(import.meta.url);
+const __dirname = path.dirname(__filename);
+
+const PORT = Number(process.env.MOCK_PORT) || 4100;
+const MODE = process.env.MOCK_MODE === 'record' ? 'record' : 'replay';
+const RECORDINGS_DIR = process.env.MOCK_RECORDINGS_DIR || path.join(__dirname, 'recordings', 'routecode');
+const DEFAULT_UPSTREAM = process.env.MOCK_UPSTREAM || 'auth.unid.net';
+
+// Query/body fields that change on every SDK request and are left out of the recording key.
+// MOCK_IGNORE_FIELDS (comma-separated) replaces the list.
+export const DEFAULT_IGNORED_FIELDS = ['timestamp', 'ts', 'time', 'nonce', 'signature', 'sign', 'requestId', 'request_id'];
+const IGNORED_FIELDS = process.env.MOCK_IGNORE_FIELDS
+  ? process.env.MOCK_IGNORE_FIELDS.split(',').map((field) => field.trim()).filter(Boolean)
+  : DEFAULT_IGNORED_FIELDS;
+
+// x-mock-upstream picks the recording folder and, in record mode, the host fetched;
+// only the RouteCode backends are accepted so it cannot escape RECORDINGS_DIR or proxy elsewhere
+const KNOWN_UPSTREAMS = new Set(['auth.unid.net', 'dev-pay.unid.net', DEFAULT_UPSTREAM]);
+
+// latencyMs ± jitterMs per response, bytesPerSec = 0 means unthrottled
+export const NETWORK_PROFILES = {
+  local: { latencyMs: 0, jitterMs: 0, bytesPerSec: 0, errorRate: 0 },
+  wifi: { latencyMs: 30, jitterMs: 10, bytesPerSec: 2_500_000, errorRate: 0 },
+  lte: { latencyMs: 80, jitterMs: 40, bytesPerSec: 1_000_000, errorRate: 0.01 },
+  '3g': { latencyMs: 300, jitterMs: 150, bytesPerSec: 100_000, errorRate: 0.03 },
+  flaky: { latencyMs: 150, jitterMs: 300, bytesPerSec: 250_000, errorRate: 0.2 },
+};
+
+// mulberry32: small, fast and identical across runs for the same seed
+function createRandom(seed) {
+  let a = seed >>> 0;
+  return () => {
+    a = (a + 0x6d2b79f5) >>> 0;
+    let t = a;
+    t = Math.imul(t ^ (t >>> 15), t | 1);
+    t ^= t + Math.imul(t ^ (t >>> 7), t | 61);
+    return ((t ^ (t >>> 14)) >>> 0) / 4294967296;
+  };
+}
+
+let random = createRandom(Number(process.env.MOCK_SEED) || 1);
+let activeProfile = NETWORK_PROFILES[process.env.MOCK_PROFILE] ? process.env.MOCK_PROFILE : 'local';
+
+const sleep = (ms) => new Promise((resolve) => setTimeout(resolve, ms));
+
+// Drops ignored keys at any depth and sorts the rest, so key order never changes the digest
+function stripFields(value, ignored) {
+  if (Array.isArray(value)) return value.map((item) => stripFields(item, ignored));
+  if (!value || typeof value !== 'object') return value;
+  return Object.fromEntries(
+    Object.keys(value)
+      .filter((key) => !ignored.has(key))
+      .sort()
+      .map((key) => [key, stripFields(value[key], ignored)]),
+  );
+}
+
+function normalizeParams(params, ignored) {
+  return [...params.entries()]
+    .filter(([key]) => !ignored.has(key))
+    .sort(([a, av], [b, bv]) => (a === b ? av.localeCompare(bv) : a.localeCompare(b)))
+    .map(([key, value]) => `${key}=${value}`)
+    .join('&');
+}
+
+// JSON and form bodies are normalized; anything else is keyed on its raw bytes
+function normalizeBody(body, contentType, ignored) {
+  if (body.length === 0) return '';
+  const text = body.toString('utf-8');
+  if (/json/i.test(contentType)) {
+    try {
+      return JSON.stringify(stripFields(JSON.parse(text), ignored));
+    } catch {
+      return text;
+    }
+  }
+  if (/x-www-form-urlencoded/i.test(contentType)) return normalizeParams(new URLSearchParams(text), ignored);
+  return body.toString('base64');
+}
+
+/**
+ * Recording key for a request: method, path, and query + body with the `ignoreFields`
+ * removed. Two SDK calls that differ only in those fields share a recording.
+ */
+export function recordingKey({ method, url, contentType = '', body = Buffer.alloc(0) }, ignoreFields = IGNORED_FIELDS) {
+  const ignored = new Set(ignoreFields);
+  const parsed = new URL(url, 'http://mock.local');
+  const query = normalizeParams(parsed.searchParams, ignored);
+  const digest = crypto
+    .createHash('sha1')
+    .update(`${method} ${parsed.pathname}\n${query}\n`)
+    .update(normalizeBody(body, contentType, ignored))
+    .digest('hex');
+  const name = parsed.pathname.replace(/[^A-Za-z0-9]+/g, '_').replace(/^_|_$/g, '') || 'root';
+  return `${method}_${name}_${digest.slice(0, 12)}`;
+}
+
+function recordingPath(recordingsDir, host, req, body, ignoreFields) {
+  const key = recordingKey(
+    { method: req.method, url: req.originalUrl, contentType: req.get('content-type') || '', body },
+    ignoreFields,
+  );
+  return path.join(recordingsDir, host, `${key}.json`);
+}
+
+function writeJsonAtomic(file, data) {
+  fs.mkdirSync(path.dirname(file), { recursive: true });
+  const tmp = `${file}.tmp`;
+  fs.writeFileSync(tmp, JSON.stringify(data, null, 2));
+  fs.renameSync(tmp, file);
+}
+
+async function record(fetchUpstream, host, req, body, file) {
+  const headers = { ...req.headers, host };
+  delete headers['content-length'];
+  delete headers['x-mock-upstream'];
+  delete headers['x-mock-profile'];
+  const upstream = await fetchUpstream(`https://${host}${req.originalUrl}`, {
+    method: req.method,
+    headers,
+    body: ['GET', 'HEAD'].includes(req.method) ? undefined : body,
+  });
+  const payload = Buffer.from(await upstream.arrayBuffer());
+  const entry = {
+    request: { method: req.method, url: req.originalUrl, body: body.toString('base64') },
+    status: upstream.status,
+    headers: { 'content-type': upstream.headers.get('content-type') || 'application/octet-stream' },
+    body: payload.toString('base64'),
+    recordedAt: new Date().toISOString(),
+  };
+  writeJsonAtomic(file, entry);
+  return entry;
+}
+
+function replay(file) {
+  if (!fs.existsSync(file)) return null;
+  return JSON.parse(fs.readFileSync(file, 'utf-8'));
+}
+
+// Writes the body in 16 KB slices paced to the profile's bandwidth
+async function sendThrottled(res, buffer, bytesPerSec) {
+  if (!bytesPerSec) {
+    res.end(buffer);
+    return;
+  }
+  const chunkSize = 16 * 1024;
+  for (let offset = 0; offset < buffer.length; offset += chunkSize) {
+    const chunk = buffer.subarray(offset, offset + chunkSize);
+    res.write(chunk);
+    await sleep((chunk.length / bytesPerSec) * 1000);
+  }
+  res.end();
+}
+
+/**
+ * Options (all optional, defaulting to the MOCK_* environment): mode ('record' | 'replay'),
+ * recordingsDir, ignoreFields (volatile fields left out of the recording key) and
+ * fetch (upstream client used in record mode).
+ */
+export function createRouteCodeMock({
+  mode = MODE,
+  recordingsDir = RECORDINGS_DIR,
+  ignoreFields = IGNORED_FIELDS,
+  fetch: fetchUpstream = fetch,
+} = {}) {
+  const app = express();
+  app.use(express.raw({ type: () => true, limit: '10mb' }));
+
+  // Control endpoints: switch profile or reseed between benchmark runs
+  app.get('/__mock/profile', (_req, res) => {
+    res.json({ mode, profile: activeProfile, profiles: NETWORK_PROFILES });
+  });
+  app.post('/__mock/profile/:name', (req, res) => {
+    if (!NETWORK_PROFILES[req.params.name]) {
+      res.status(404).json({ error: `Profile ${req.params.name} not found` });
+      return;
+    }
+    activeProfile = req.params.name;
+    if (req.query.seed) random = createRandom(Number(req.query.seed));
+    res.json({ profile: activeProfile });
+  });
+
+  app.all('*', async (req, res) => {
+    const host = String(req.get('x-mock-upstream') || DEFAULT_UPSTREAM);
+    if (!KNOWN_UPSTREAMS.has(host)) {
+      res.status(400).json({ error: `Unknown upstream ${host}` });
+      return;
+    }
+    const profile = NETWORK_PROFILES[req.get('x-mock-profile')] || NETWORK_PROFILES[activeProfile];
+    const body = Buffer.isBuffer(req.body) ? req.body : Buffer.alloc(0);
+    const file = recordingPath(recordingsDir, host, req, body, ignoreFields);
+
+    try {
+      const entry = mode === 'record' ? await record(fetchUpstream, host, req, body, file) : replay(file);
+      if (!entry) {
+        res.status(404).json({ error: 'No recording', host, method: req.method, url: req.originalUrl });
+        return;
+      }
+
+      const delay = Math.max(0, profile.latencyMs + (random() * 2 - 1) * profile.jitterMs);
+      await sleep(delay);
+
+      if (mode === 'replay' && random() < profile.errorRate) {
+        res.status(503).json({ error: 'Injected failure' });
+        return;
+      }
+
+      res.status(entry.status).set(entry.headers);
+      await sendThrottled(res, Buffer.from(entry.body, 'base64'), profile.bytesPerSec);
+    } catch (e) {
+      // eslint-disable-next-line no-console
+      console.error(`RouteCode mock ${req.method} ${req.originalUrl} failed:`, e.message);
+      if (!res.headersSent) res.status(502).json({ error: e.message });
+    }
+  });
+
+  return app;
+}
+
+if (process.argv[1] === __filename) {
+  createRouteCodeMock().listen(PORT, () => {
+    // eslint-disable-next-line no-console
+    console.log(`RouteCode mock (${MODE}, profile ${activeProfile}) listening on http://localhost:${PORT}`);
+  });
+}
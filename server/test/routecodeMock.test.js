@@ -0,0 +1,61 @@
+import assert from 'node:assert/strict';
+import fs from 'node:fs';
+import os from 'node:os';
+import path from 'node:path';
+import { after, test } from 'node:test';
+import { createRouteCodeMock, recordingKey } from '../routecodeMock.js';
+
+const recordingsDir = fs.mkdtempSync(path.join(os.tmpdir(), 'routecode-mock-'));
+after(() => fs.rmSync(recordingsDir, { recursive: true, force: true }));
+
+async function listen(app) {
+  const server = await new Promise((resolve) => {
+    const started = app.listen(0, () => resolve(started));
+  });
+  return { url: `http://127.0.0.1:${server.address().port}`, close: () => new Promise((resolve) => server.close(resolve)) };
+}
+
+function sdkRequest(baseUrl, timestamp) {
+  return fetch(`${baseUrl}/api/v1/user/info?userId=u1&timestamp=${timestamp}&nonce=n${timestamp}`, {
+    method: 'POST',
+    headers: { 'content-type': 'application/json' },
+    body: JSON.stringify({ userId: 'u1', timestamp, signature: `sig-${timestamp}` }),
+  });
+}
+
+test('recording key ignores volatile fields but not parameters', () => {
+  const key = (url, body) =>
+    recordingKey({ method: 'POST', url, contentType: 'application/json', body: Buffer.from(JSON.stringify(body)) });
+  const base = key('/api?userId=u1&timestamp=1', { userId: 'u1', nonce: 'a' });
+  assert.equal(key('/api?timestamp=2&userId=u1', { nonce: 'b', userId: 'u1' }), base);
+  assert.notEqual(key('/api?userId=u2&timestamp=1', { userId: 'u1', nonce: 'a' }), base);
+  assert.notEqual(key('/api?userId=u1&timestamp=1', { userId: 'u2', nonce: 'a' }), base);
+});
+
+test('a recorded request replays when only its timestamp differs', async () => {
+  const upstreamCalls = [];
+  const recorder = await listen(createRouteCodeMock({
+    mode: 'record',
+    recordingsDir,
+    fetch: async (url) => {
+      upstreamCalls.push(url);
+      return new Response(JSON.stringify({ certificates: ['c1'] }), { status: 200, headers: { 'content-type': 'application/json' } });
+    },
+  }));
+  try {
+    const recorded = await sdkRequest(recorder.url, 1700000000);
+    assert.equal(recorded.status, 200);
+  } finally {
+    await recorder.close();
+  }
+  assert.equal(upstreamCalls.length, 1);
+
+  const replayer = await listen(createRouteCodeMock({ mode: 'replay', recordingsDir }));
+  try {
+    const replayed = await sdkRequest(replayer.url, 1700000999);
+    assert.equal(replayed.status, 200);
+    assert.deepEqual(await replayed.json(), { certificates: ['c1'] });
+  } finally {
+    await replayer.close();
+  }
+});
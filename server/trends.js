@@ -1,8 +1,11 @@
+import crypto from 'crypto';
 import fs from 'fs';
 import googleTrends from 'google-trends-api';
 import cron from 'node-cron';
 import path from 'path';
 import { fileURLToPath } from 'url';
+import { encodeCbor } from './cbor.js';
+import { fetchRegions } from './regionFetcher.js';
 
 const __filename = fileURLToPath(import.meta.url);
 const __dirname = path.dirname(__filename);
@@ -29,25 +32,25 @@ function writeJsonSafe(filePath, data) {
   fs.writeFileSync(filePath, JSON.stringify(data, null, 2), 'utf8');
 }
 
-export async function ensureDataInitialized() {
-  if (!readJsonSafe(dataFile)) {
-    writeJsonSafe(dataFile, { regions: {}, lastGlobalBuildAt: null });
-    await updateAllRegions();
-  }
+// Write to a temp file and rename so a crash mid-write never leaves a truncated database
+async function writeJsonAtomic(filePath, data) {
+  await fs.promises.mkdir(path.dirname(filePath), { recursive: true });
+  const tmpPath = `${filePath}.tmp`;
+  await fs.promises.writeFile(tmpPath, JSON.stringify(data, null, 2), 'utf8');
+  await fs.promises.rename(tmpPath, filePath);
 }
 
-export function getRegions() {
-  return REGION_CODES.slice();
-}
+// In-memory copy of the database. Loaded once at startup and replaced as a whole
+// by updateAllRegions, so request handlers never touch the disk and always see
+// a consistent set of regions.
+let snapshot = null;
 
-export function getRegionData(region) {
-  const db = readJsonSafe(dataFile);
-  if (!db) return null;
-  return db.regions[region] || null;
-}
+// Global top-100 derived from the snapshot, rebuilt only when the snapshot changes.
+// Pre-serialized JSON and CBOR bodies, each with its own ETag, let /api/trends/summary
+// answer without any work whichever representation the client negotiates.
+let summaryIndex = null;
 
-export function getGlobalSummary() {
-  const db = readJsonSafe(dataFile) || { regions: {} };
+function buildGlobalSummary(db) {
   const aggregate = new Map();
   for (const region of Object.keys(db.regions)) {
     const list = db.regions[region]?.top || [];
@@ -64,6 +67,56 @@ export function getGlobalSummary() {
   return { updatedAt: db.lastGlobalBuildAt, top };
 }
 
+function bodyEtag(body) {
+  return `"${crypto.createHash('sha1').update(body).digest('base64url')}"`;
+}
+
+// Swap the snapshot and its summary together so readers never see them out of step
+function publishSnapshot(next) {
+  const summary = buildGlobalSummary(next);
+  const body = Buffer.from(JSON.stringify(summary), 'utf8');
+  const cborBody = encodeCbor(summary);
+  const version = (summaryIndex?.version || 0) + 1;
+  snapshot = next;
+  summaryIndex = {
+    version,
+    etag: bodyEtag(body),
+    body,
+    cbor: { etag: bodyEtag(cborBody), body: cborBody },
+    summary,
+  };
+}
+
+export async function ensureDataInitialized() {
+  const stored = readJsonSafe(dataFile);
+  if (stored) {
+    publishSnapshot(stored);
+    return;
+  }
+  publishSnapshot({ regions: {}, lastGlobalBuildAt: null });
+  writeJsonSafe(dataFile, snapshot);
+  await updateAllRegions();
+}
+
+export function getRegions() {
+  return REGION_CODES.slice();
+}
+
+export function getRegionData(region) {
+  if (!snapshot) return null;
+  return snapshot.regions[region] || null;
+}
+
+export function getGlobalSummary() {
+  return summaryIndex ? summaryIndex.summary : buildGlobalSummary({ regions: {}, lastGlobalBuildAt: null });
+}
+
+// Pre-serialized summary for HTTP: { version, etag, body, cbor: { etag, body } }
+export function getGlobalSummaryPayload() {
+  if (!summaryIndex) publishSnapshot({ regions: {}, lastGlobalBuildAt: null });
+  return summaryIndex;
+}
+
 function parseTrafficToNumber(formattedTraffic) {
   if (!formattedTraffic) return 0;
   // e.g., "200K+" or "5M+"
@@ -75,9 +128,11 @@ function parseTrafficToNumber(formattedTraffic) {
   return Math.round(num * multiplier);
 }
 
-async function fetchTopForRegion(region) {
-  // Top charts (daily) aren't officially exposed for all regions; using trending searches as proxy
+async function fetchTopForRegion(region, { signal } = {}) {
+  // Top charts (daily) aren't officially exposed for all regions; using trending searches as proxy.
+  // google-trends-api takes no abort signal, so a timed-out request is only dropped once it returns.
   const results = await googleTrends.trendingSearches({ geo: region });
+  signal?.throwIfAborted();
   const json = JSON.parse(results);
   const days = json?.default?.trendingSearchesDays || [];
   const entries = [];
@@ -108,20 +163,71 @@ async function fetchTopForRegion(region) {
     .slice(0, 100);
 }
 
-export async function updateAllRegions() {
+let refreshInFlight = null;
+
+// Regions that arrive mid-refresh are published together at most this often, so a
+// refresh re-encodes the summary a handful of times rather than once per region
+const PUBLISH_INTERVAL_MS = 1000;
+
+/**
+ * Refresh every region with bounded parallelism. Regions reach the in-memory
+ * snapshot in batches as they arrive; the file is written once at the end.
+ * Options (all optional): fetchRegion (inject a stub upstream), concurrency,
+ * timeoutMs, retries, backoffMs. A call without options while a refresh is running
+ * joins it; passing options then rejects, since they could not be applied.
+ */
+export function updateAllRegions(options = {}) {
+  if (refreshInFlight) {
+    if (Object.keys(options).length > 0) {
+      return Promise.reject(new Error('A trends refresh is already running; options only apply to a new refresh'));
+    }
+    return refreshInFlight;
+  }
+  refreshInFlight = runRegionRefresh(options).finally(() => {
+    refreshInFlight = null;
+  });
+  return refreshInFlight;
+}
+
+async function runRegionRefresh({ fetchRegion = fetchTopForRegion, ...fetchOptions } = {}) {
   const now = new Date().toISOString();
-  const db = readJsonSafe(dataFile) || { regions: {} };
-  for (const region of REGION_CODES) {
-    try {
-      const top = await fetchTopForRegion(region);
-      db.regions[region] = { updatedAt: now, top };
-    } catch (e) {
+  const arrived = {};
+  let publishTimer = null;
+
+  const publishArrived = (lastGlobalBuildAt) => {
+    const current = snapshot || { regions: {}, lastGlobalBuildAt: null };
+    const next = {
+      regions: { ...current.regions, ...arrived },
+      lastGlobalBuildAt: lastGlobalBuildAt === undefined ? current.lastGlobalBuildAt : lastGlobalBuildAt,
+    };
+    publishSnapshot(next);
+    return next;
+  };
+
+  const { failed } = await fetchRegions(REGION_CODES, fetchRegion, (region, error, top) => {
+    if (error) {
       // eslint-disable-next-line no-console
-      console.error(`Failed to update region ${region}:`, e?.message || e);
+      console.error(`Failed to update region ${region}:`, error?.message || error);
+      return;
+    }
+    arrived[region] = { updatedAt: now, top };
+    if (!publishTimer) {
+      publishTimer = setTimeout(() => {
+        publishTimer = null;
+        publishArrived();
+      }, PUBLISH_INTERVAL_MS);
     }
+  }, fetchOptions);
+
+  clearTimeout(publishTimer);
+  const next = publishArrived(now);
+  try {
+    await writeJsonAtomic(dataFile, next);
+  } catch (e) {
+    // eslint-disable-next-line no-console
+    console.error('Failed to persist trends snapshot:', e?.message || e);
   }
-  db.lastGlobalBuildAt = now;
-  writeJsonSafe(dataFile, db);
+  return { updatedAt: now, failed };
 }
 
 export function scheduleTrendUpdates() {
@@ -7,21 +7,39 @@ import { colors } from '../theme/colors';
 interface ResponsiveCardProps {
   cardType?: string;
   isSmall?: boolean;
+  /** Pre-rendered card face from YellPay.renderCardImages; replaces the layered artwork */
+  imageUri?: string | null;
 }
 
-const ResponsiveCard = ({ cardType, isSmall }: ResponsiveCardProps) => {
+const ResponsiveCard = ({ cardType, isSmall, imageUri }: ResponsiveCardProps) => {
+  const containerStyle = {
+    position: 'relative' as const,
+    margin: isSmall ? 0 : 16,
+    width: '90%' as const, // responsive width
+    aspectRatio: 16 / 9, // keeps image responsive
+    borderRadius: isSmall ? 6 : 12,
+    overflow: 'hidden' as const,
+    alignSelf: 'center' as const,
+  };
+
+  if (imageUri) {
+    return (
+      <View style={containerStyle}>
+        <Image
+          source={{ uri: imageUri }}
+          alt="Card"
+          style={{
+            width: '100%',
+            height: '100%',
+            resizeMode: 'cover',
+          }}
+        />
+      </View>
+    );
+  }
+
   return (
-    <View
-      style={{
-        position: 'relative',
-        margin: isSmall ? 0 : 16,
-        width: '90%', // responsive width
-        aspectRatio: 16 / 9, // keeps image responsive
-        borderRadius: isSmall ? 6 : 12,
-        overflow: 'hidden',
-        alignSelf: 'center',
-      }}
-    >
+    <View style={containerStyle}>
       <Image
         source={
           cardType
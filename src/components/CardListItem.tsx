@@ -13,6 +13,7 @@ interface CardListItemProps {
   isDefault?: boolean;
   onPress?: () => void;
   isModal?: boolean;
+  cardImageUri?: string | null;
 }
 
 const CardListItem = ({
@@ -23,6 +24,7 @@ const CardListItem = ({
   isDefault,
   onPress,
   isModal,
+  cardImageUri,
 }: CardListItemProps) => {
   return (
     <VStack gap={16} position="relative">
@@ -54,7 +56,7 @@ const CardListItem = ({
         gap={16}
       >
         <View width={122} height={66}>
-          <Card cardType={cardType} isSmall />
+          <Card cardType={cardType} isSmall imageUri={cardImageUri} />
         </View>
         <VStack flex={1} gap={8}>
           {isDefault && (
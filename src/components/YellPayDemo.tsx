@@ -12,6 +12,7 @@ import {
   View,
 } from 'react-native';
 import type { YellPayModule } from '../types/YellPay';
+import { autoAuthApprovalCached, invalidateAuthSessionOnError } from '../utils/authSession';
 
 const { YellPay }: { YellPay: YellPayModule } = NativeModules;
 
@@ -207,11 +208,17 @@ const YellPayDemo: React.FC = () => {
 
   const testAutoAuthApprovalProduction = async () => {
     try {
-      const result = await YellPay.autoAuthApprovalProduction();
+      // The cache is per user; before initUser there is no user to scope it to
+      const result = state.userId
+        ? await autoAuthApprovalCached(YellPay, state.userId)
+        : await YellPay.autoAuthApprovalProduction();
       showResult('Auto Auth Approval (Production)', result);
       if (result.userInfo) {
         updateState('userInfo', result.userInfo);
       }
+      if ('revalidation' in result && result.revalidation) {
+        await result.revalidation;
+      }
     } catch (error) {
       showError('Auto Auth Approval (Production)', error);
     }
@@ -274,6 +281,7 @@ const YellPayDemo: React.FC = () => {
       }
     } catch (error) {
       console.log('testRegisterCard() - ERROR:', error);
+      invalidateAuthSessionOnError(error, state.userId);
       showError('Register Card', error);
     }
   };
@@ -321,6 +329,7 @@ const YellPayDemo: React.FC = () => {
       showResult('Make Payment', result);
     } catch (error) {
       console.log('testMakePayment() - ERROR:', error);
+      invalidateAuthSessionOnError(error, state.userId);
       showError('Make Payment', error);
     }
   };
@@ -373,7 +382,7 @@ const YellPayDemo: React.FC = () => {
 
   const testGetMainCreditCard = async () => {
     try {
-      const result = await YellPay.getMainCreditCard();
+      const result = await YellPay.getMainCreditCard(state.userId);
       showResult('Get Main Credit Card', result);
     } catch (error) {
       showError('Get Main Credit Card', error);
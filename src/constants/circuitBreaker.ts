@@ -0,0 +1,29 @@
+/**
+ * Circuit breaker spec shared by the iOS and Android YellPay modules.
+ * Sent once at startup via YellPay.configureCircuitBreaker(); the native
+ * defaults mirror these values so both platforms behave the same before then.
+ *
+ * closed    → open       when ≥ minimumCalls of the last windowSize outcomes exist
+ *                         and their failure rate reaches failureRateThreshold
+ * open      → half-open  after the cool-down (baseCooldownMs doubled per
+ *                         consecutive trip, capped at maxCooldownMs)
+ * half-open → closed     when halfOpenProbes probe calls all succeed
+ * half-open → open       on any probe failure (next cool-down is doubled)
+ */
+export interface CircuitBreakerSpec {
+  windowSize: number;
+  minimumCalls: number;
+  failureRateThreshold: number;
+  baseCooldownMs: number;
+  maxCooldownMs: number;
+  halfOpenProbes: number;
+}
+
+export const CIRCUIT_BREAKER_SPEC: CircuitBreakerSpec = {
+  windowSize: 20,
+  minimumCalls: 5,
+  failureRateThreshold: 0.5,
+  baseCooldownMs: 5_000,
+  maxCooldownMs: 5 * 60_000,
+  halfOpenProbes: 1,
+};
@@ -16,6 +16,7 @@ export interface RegistrationState {
   user: User | null; // Store complete user data
   isRegistered: boolean;
   certificates: UserCertificateInfo[]; // Store user certificates from SDK
+  certificatesUpdatedAt: string | null; // Last successful getUserInfo; cached certificates are shown while revalidating
   isAuthenticated: boolean; // Track if SDK authentication is completed
   isCardRegistered: boolean; // Track if at least one card is registered
 }
@@ -29,10 +30,21 @@ const initialState: RegistrationState = {
   user: null,
   isRegistered: false,
   certificates: [],
+  certificatesUpdatedAt: null,
   isAuthenticated: false,
   isCardRegistered: false,
 };
 
+// Certificates only change when examination status moves, so compare by value
+export const sameCertificates = (a: UserCertificateInfo[], b: UserCertificateInfo[]) =>
+  a.length === b.length &&
+  a.every(
+    (cert, index) =>
+      cert.certificateType === b[index].certificateType &&
+      cert.status === b[index].status &&
+      cert.additionalInfo === b[index].additionalInfo,
+  );
+
 const registrationSlice = createSlice({
   name: 'registration',
   initialState,
@@ -62,6 +74,9 @@ const registrationSlice = createSlice({
       state.isRegistered = false;
     },
     setCertificates: (state, action: PayloadAction<UserCertificateInfo[]>) => {
+      state.certificatesUpdatedAt = new Date().toISOString();
+      // Keep the same array when nothing changed so certificate selectors don't re-render
+      if (sameCertificates(state.certificates, action.payload)) return;
       state.certificates = action.payload;
       // Check if at least one card is registered (status === 1 means active/registered)
       state.isCardRegistered = action.payload.some(cert => cert.status === 1);
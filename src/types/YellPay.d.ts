@@ -1,3 +1,5 @@
+import type { CircuitBreakerSpec } from '../constants/circuitBreaker';
+
 export interface AuthResponse {
   status: number;
 }
@@ -19,6 +21,151 @@ export interface ProductionConfig {
   environmentMode: string;
 }
 
+export interface ConfirmLimitAmountResponse {
+  userInfo: { [key: string]: any };
+  alert: { [key: string]: any };
+}
+
+export interface WarmUpConnectionsResponse {
+  environmentMode: string;
+  /** false when the environment was warmed recently and nothing was sent */
+  started: boolean;
+}
+
+export interface ConnectionStats {
+  warmups: number;
+  failures: number;
+  handshakes: number;
+  handshakesAvoided: number;
+  lastWarmupAt: number | null;
+  lastHandshakeMs: number | null;
+}
+
+export interface StoredNotification {
+  /** iOS: decoded fields (id, title, message, date); Android: raw `notification` string */
+  [key: string]: string;
+}
+
+export interface SyncNotificationsResponse {
+  /** Entries appended by this sync */
+  added: number;
+  /** Entries in the local store after the sync */
+  total: number;
+  /** lastUpdateNotification watermark sent on the next sync */
+  lastUpdate: number;
+}
+
+export interface StoredNotificationsPage {
+  total: number;
+  lastUpdate: number;
+  /** Newest first */
+  notifications: StoredNotification[];
+}
+
+export interface StoredNotificationsQuery {
+  /** nextCursor from the previous page; omit or null for the newest entries */
+  cursor?: number | null;
+  limit: number;
+  /** Case-insensitive substring match over every field */
+  search?: string;
+  /** Inclusive bounds compared against `date` in the SDK's format (iOS entries only carry a date) */
+  since?: string;
+  until?: string;
+}
+
+export interface StoredNotificationsQueryPage {
+  total: number;
+  /** Pass back as `cursor` for the next page; null when nothing older matches */
+  nextCursor: number | null;
+  /** Newest first */
+  notifications: StoredNotification[];
+}
+
+export interface StreamToken {
+  streamSeed: string;
+  /** Stream creation time in epoch seconds (milliseconds are also accepted) */
+  streamTime: number;
+}
+
+export interface PreparePaymentResponse {
+  /** false when the main card lookup failed; makePayment will retry it */
+  ready: boolean;
+  /** true when the main card was already cached */
+  cached?: boolean;
+  card?: { [key: string]: any } | null;
+  code?: string;
+  message?: string;
+}
+
+export interface CardFaceRequest {
+  /** Masked or full card number; only the last four digits key the cache */
+  cardNumber: string;
+  expiryDate: string;
+}
+
+/** SDK flows that present their own screens and can be cancelled with cancelFlow */
+export type YellPayUiFlow = 'registerCard' | 'makePayment' | 'cardSelect' | 'paymentScheme';
+
+export type YellPayBatchMethod =
+  | 'getUserInfo'
+  | 'getInformation'
+  | 'getNotification'
+  | 'getConfirmLimitAmount';
+
+export interface YellPayBatchOperation {
+  method: YellPayBatchMethod;
+  userId: string;
+  /** Watermark for getInformation / getNotification (defaults to 0) */
+  lastUpdate?: number;
+}
+
+export type YellPayBatchResult =
+  | { method: YellPayBatchMethod; ok: true; result: any }
+  | { method: YellPayBatchMethod; ok: false; code: string; message: string };
+
+export interface LatencyHistogram {
+  count: number;
+  p50: number;
+  p95: number;
+  p99: number;
+  max: number;
+  mean: number;
+}
+
+export interface MethodMetrics {
+  /** Bridge call start to SDK callback (or failure) */
+  latencyMs: LatencyHistogram;
+  /** Converting the SDK payload into bridge values */
+  decodeMs: LatencyHistogram;
+  /** Only for requests the bridge sends itself (connection warm-up) */
+  ttfbMs: LatencyHistogram;
+  errors: number;
+  timeouts: number;
+  bytes: number;
+}
+
+export interface CircuitStatus {
+  state: 'closed' | 'open' | 'half-open';
+  /** Failures among the outcomes currently in the window */
+  failures: number;
+  calls: number;
+  /** Consecutive opens since the last full recovery; doubles the cool-down */
+  trips: number;
+  retryInMs: number;
+}
+
+export interface CrashProtectionStatus {
+  blockedOperations: string[];
+  operationAttempts: { [key: string]: number };
+  circuits: { [operation: string]: CircuitStatus };
+}
+
+export interface MetricsSnapshot extends Partial<CrashProtectionStatus> {
+  methods: { [method: string]: MethodMetrics };
+  breakerTransitions: { method: string; state: string; at: number }[];
+  pendingCalls: number;
+}
+
 export interface YellPayModule {
   // ===== CONFIGURATION METHODS =====
 
@@ -28,6 +175,27 @@ export interface YellPayModule {
    */
   getProductionConfig(): Promise<ProductionConfig>;
 
+  /**
+   * Debug builds only: send RouteAuth calls to another host, e.g. the local
+   * RouteCode mock in server/routecodeMock.js. Pass '' to restore the default.
+   * @param domain Host (and optional port) used in place of AUTH_DOMAIN
+   */
+  setAuthDomainOverride(domain: string): Promise<{ authDomain: string; overridden: boolean }>;
+
+  // ===== CONNECTION METHODS =====
+
+  /**
+   * Open the backend connections of the current environment ahead of a payment
+   * @returns Promise that resolves once the warm-up requests are sent
+   */
+  warmUpConnections(): Promise<WarmUpConnectionsResponse>;
+
+  /**
+   * Handshake / connection reuse counters per environment mode
+   * @returns Promise that resolves to stats keyed by environment mode
+   */
+  getConnectionStats(): Promise<{ [environmentMode: string]: ConnectionStats }>;
+
   // ===== AUTHENTICATION METHODS =====
 
   /**
@@ -129,6 +297,35 @@ export interface YellPayModule {
     payUserId: string
   ): Promise<PaymentResponse>;
 
+  /**
+   * Payment launched from a URL scheme (iOS only)
+   * @param uuid User unique identifier
+   * @param userNo User number
+   * @param payUserId Payment user identifier
+   * @param streamSeed Stream seed; pass '' to use the freshest pooled token
+   * @param streamTime Stream creation time (ignored when a pooled token is used)
+   * @returns Promise that resolves to payment result
+   */
+  paymentScheme(
+    uuid: string,
+    userNo: number,
+    payUserId: string,
+    streamSeed: string,
+    streamTime: number
+  ): Promise<PaymentResponse>;
+
+  /**
+   * Pool stream tokens ahead of a scheme payment; expired and duplicate seeds are dropped (iOS only)
+   * @param tokens Seed/time pairs issued by the merchant backend
+   * @returns Promise that resolves to the pool size after adding
+   */
+  addStreamTokens(tokens: StreamToken[]): Promise<{ pooled: number; accepted: number }>;
+
+  /**
+   * Set how many stream tokens are kept and how long after streamTime they stay valid (iOS only)
+   */
+  configureStreamTokenPool(capacity: number, maxAgeMs: number): Promise<{ pooled: number }>;
+
   /**
    * Get payment history for user
    * @param userId User identifier
@@ -156,11 +353,39 @@ export interface YellPayModule {
    */
   cardSelect(userId: string): Promise<PaymentResponse>;
 
+  /**
+   * Cancel a running registerCard / makePayment / cardSelect flow (or paymentScheme on iOS)
+   * and close its SDK screens. The flow's own promise rejects with FLOW_CANCELLED.
+   * @returns Promise that resolves to false when the flow is not running
+   */
+  cancelFlow(flow: YellPayUiFlow): Promise<boolean>;
+
   /**
    * Get main credit card information
+   * @param payUserId Payment user ID; the cached main card is only reused for the same user
    * @returns Promise that resolves to main credit card info
    */
-  getMainCreditCard(): Promise<string>;
+  getMainCreditCard(payUserId: string): Promise<string>;
+
+  /**
+   * Set the main card; the cached main card is replaced by the SDK result (iOS only)
+   * @param uuid Card UUID
+   * @param userNo Card user number
+   * @returns Promise that resolves to the new main card
+   */
+  setMainCard(uuid: string, userNo: number): Promise<{ [key: string]: any }>;
+
+  /**
+   * Warm connections and cache the main card ahead of a payment; never rejects
+   * @param payUserId Payment user ID the card is cached for
+   * @returns Promise that resolves to the preparation result
+   */
+  preparePayment(payUserId: string): Promise<PreparePaymentResponse>;
+
+  /**
+   * Drop the cached main card (call on logout); authentication and initUser also drop it
+   */
+  clearMainCardCache(): Promise<boolean>;
 
   /**
    * Get user information
@@ -184,6 +409,33 @@ export interface YellPayModule {
    */
   getNotification(payUserId: string, lastUpdate: number): Promise<string>;
 
+  /**
+   * Fetch notifications newer than the locally stored watermark and append them to the store
+   * @param payUserId Payment user identifier
+   * @returns Promise that resolves to sync counts (no notification payloads)
+   */
+  syncNotifications(payUserId: string): Promise<SyncNotificationsResponse>;
+
+  /**
+   * Read a page of locally stored notifications, newest first
+   * @param payUserId Payment user identifier
+   * @param offset Entries to skip
+   * @param limit Maximum entries to return
+   * @returns Promise that resolves to the page and store totals
+   */
+  getStoredNotifications(payUserId: string, offset: number, limit: number): Promise<StoredNotificationsPage>;
+
+  /**
+   * Page through locally stored notifications with a stable cursor, optionally filtered
+   * @param payUserId Payment user identifier
+   * @param query Cursor, page size and filters
+   * @returns Promise that resolves to the page and the cursor for the next one
+   */
+  queryStoredNotifications(
+    payUserId: string,
+    query: StoredNotificationsQuery
+  ): Promise<StoredNotificationsQueryPage>;
+
   /**
    * Get information
    * @param userId User identifier
@@ -192,6 +444,59 @@ export interface YellPayModule {
    */
   getInformation(userId: string, infoType: number): Promise<string>;
 
+  /**
+   * Get used amount and upper limit amount (iOS only)
+   * @param userId User identifier
+   * @returns Promise that resolves to limit amount information
+   */
+  getConfirmLimitAmount(userId: string): Promise<ConfirmLimitAmountResponse>;
+
+  // ===== CANCELLABLE REQUEST METHODS =====
+
+  /**
+   * Run a read-only SDK call that can be abandoned with cancelRequest (iOS only).
+   * Repeating a request that is still running joins it; reusing a running id for a
+   * different call cancels the earlier one. Requests never join or cancel the direct
+   * methods, and cancelling one id leaves other ids waiting on the same call running.
+   * @param method One of the batchable methods
+   * @param lastUpdate Used by getNotification / getInformation, ignored otherwise
+   * @param requestId Caller-chosen id, e.g. per screen
+   * @returns Promise that resolves to the same shape as the direct method;
+   * rejects with REQUEST_CANCELLED once cancelled
+   */
+  request(method: YellPayBatchMethod, userId: string, lastUpdate: number, requestId: string): Promise<any>;
+
+  /**
+   * Cancel a pending request (iOS only)
+   * @returns Promise that resolves to false when no request with that id is running
+   */
+  cancelRequest(requestId: string): Promise<boolean>;
+
+  // ===== BATCH METHODS =====
+
+  /**
+   * Run several read-only SDK calls concurrently in a single bridge round trip
+   * @param operations Calls to run
+   * @returns Promise that resolves to one result per operation, in request order.
+   * A failing operation is reported in its entry and never rejects the batch.
+   */
+  batch(operations: YellPayBatchOperation[]): Promise<YellPayBatchResult[]>;
+
+  // ===== CARD IMAGE METHODS =====
+
+  /**
+   * Render all card faces in one pass, served from the memory/disk cache when possible (iOS only)
+   * @param cards Cards to render
+   * @param scale Pixel scale (0 for the screen scale)
+   * @returns Promise that resolves to file URIs in input order
+   */
+  renderCardImages(cards: CardFaceRequest[], scale: number): Promise<{ uri: string | null }[]>;
+
+  /**
+   * Drop all cached card faces (iOS only)
+   */
+  clearCardImageCache(): Promise<boolean>;
+
   // ===== PRODUCTION CONVENIENCE METHODS =====
 
   /**
@@ -398,10 +703,26 @@ export interface YellPayModule {
    * Get current crash protection status
    * @returns Promise that resolves to protection status
    */
-  getCrashProtectionStatus(): Promise<{
-    blockedOperations: string[];
-    operationAttempts: { [key: string]: number };
-  }>;
+  getCrashProtectionStatus(): Promise<CrashProtectionStatus>;
+
+  /**
+   * Apply the shared circuit breaker thresholds (see src/constants/circuitBreaker.ts)
+   */
+  configureCircuitBreaker(spec: CircuitBreakerSpec): Promise<{ configured: boolean }>;
+
+  // ===== METRICS METHODS =====
+
+  /**
+   * Per-method latency/decode/TTFB histograms, error and timeout counts and
+   * recent circuit-breaker transitions since launch (or the last resetMetrics)
+   * @returns Promise that resolves to the metrics snapshot
+   */
+  getMetricsSnapshot(): Promise<MetricsSnapshot>;
+
+  /**
+   * Clear all recorded metrics
+   */
+  resetMetrics(): Promise<{ reset: boolean }>;
 }
 
 declare module 'react-native' {
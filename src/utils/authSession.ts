@@ -0,0 +1,154 @@
+/**
+ * YellPay Auth Session Cache
+ * Keeps the last successful RouteAuth auto-approval per user in SecureStore
+ * (Keychain / Keystore) with an expiry, so app starts inside the session window
+ * can show the approved state without waiting for the full unid approval.
+ *
+ * The stored result is only a UI hint: RouteAuth's in-process auth state is not
+ * persisted by the SDK, so a stored hit still runs the approval in the background
+ * (exposed as `revalidation`) and callers that go on to make SDK calls await it.
+ * Once RouteAuth has approved in this process, later calls reuse that result.
+ *
+ * RouteAuth's keys never leave the SDK; only the approval result (status and
+ * userInfo) is cached. Expired or unreadable entries fall through to a live
+ * approval, concurrent callers share a single in-flight approval, and an SDK
+ * AUTHENTICATION_ERROR drops the user's session.
+ */
+
+import * as SecureStore from 'expo-secure-store';
+import type { AuthApprovalResponse, YellPayModule } from '../types/YellPay';
+
+const SESSION_KEY_PREFIX = 'yellpay_auth_session_';
+
+/** How long an auto-approval is reused before RouteAuth is asked again */
+export const AUTH_SESSION_TTL_MS = 30 * 60_000;
+
+interface StoredAuthSession {
+  status: number;
+  userInfo?: string;
+  approvedAt: number;
+  expiresAt: number;
+}
+
+export interface CachedAuthApproval extends AuthApprovalResponse {
+  /** true when RouteAuth did not run for this call */
+  cached: boolean;
+  expiresAt: number;
+  /**
+   * Set when the result came from SecureStore: the RouteAuth approval restoring the
+   * SDK's in-process auth state. Await it before SDK calls that need authentication.
+   */
+  revalidation?: Promise<CachedAuthApproval>;
+}
+
+// Approvals RouteAuth granted in this process, by user
+const approvedInProcess = new Map<string, StoredAuthSession>();
+const inFlight = new Map<string, Promise<CachedAuthApproval>>();
+
+// SecureStore keys only allow alphanumerics, '.', '-' and '_'
+function sessionKey(userId: string): string {
+  return SESSION_KEY_PREFIX + userId.replace(/[^A-Za-z0-9._-]/g, '_');
+}
+
+async function readSession(userId: string): Promise<StoredAuthSession | null> {
+  try {
+    const raw = await SecureStore.getItemAsync(sessionKey(userId));
+    if (!raw) return null;
+    const session = JSON.parse(raw) as StoredAuthSession;
+    return typeof session.expiresAt === 'number' ? session : null;
+  } catch {
+    return null;
+  }
+}
+
+/** Valid stored session for `userId`, or null when there is none or it has expired */
+export async function getCachedAuthSession(userId: string): Promise<CachedAuthApproval | null> {
+  const session = await readSession(userId);
+  if (!session || session.expiresAt <= Date.now()) return null;
+  return { status: session.status, userInfo: session.userInfo, expiresAt: session.expiresAt, cached: true };
+}
+
+/** Drop the user's cached session (logout, account deletion, or an SDK auth error) */
+export async function clearAuthSession(userId: string | null | undefined): Promise<void> {
+  if (!userId) return;
+  approvedInProcess.delete(userId);
+  try {
+    await SecureStore.deleteItemAsync(sessionKey(userId));
+  } catch (error) {
+    console.warn('Failed to clear auth session:', error);
+  }
+}
+
+export function isAuthenticationError(error: any): boolean {
+  return error?.code === 'AUTHENTICATION_ERROR';
+}
+
+/**
+ * Drops the user's session when `error` is an SDK AUTHENTICATION_ERROR, so the next
+ * autoAuthApprovalCached runs RouteAuth again. Returns true when it did.
+ */
+export function invalidateAuthSessionOnError(error: any, userId: string | null | undefined): boolean {
+  if (!isAuthenticationError(error)) return false;
+  clearAuthSession(userId);
+  return true;
+}
+
+function approve(YellPay: YellPayModule, userId: string, ttlMs: number): Promise<CachedAuthApproval> {
+  const running = inFlight.get(userId);
+  if (running) return running;
+
+  const approval = (async () => {
+    try {
+      const result = await YellPay.autoAuthApprovalProduction();
+      const approvedAt = Date.now();
+      const session: StoredAuthSession = {
+        status: result.status,
+        userInfo: result.userInfo,
+        approvedAt,
+        expiresAt: approvedAt + ttlMs,
+      };
+      approvedInProcess.set(userId, session);
+      await SecureStore.setItemAsync(sessionKey(userId), JSON.stringify(session)).catch((error) => {
+        console.warn('Failed to persist auth session:', error);
+      });
+      return { ...result, expiresAt: session.expiresAt, cached: false };
+    } catch (error) {
+      // A failed approval means the stored one can no longer be trusted
+      await clearAuthSession(userId);
+      throw error;
+    }
+  })().finally(() => {
+    inFlight.delete(userId);
+  });
+
+  inFlight.set(userId, approval);
+  return approval;
+}
+
+/**
+ * Resolve the production auto-approval for `userId`. An approval from this process is
+ * reused while valid; a stored one resolves immediately as a hint with RouteAuth running
+ * in the background. Pass `force` to always wait for RouteAuth.
+ */
+export async function autoAuthApprovalCached(
+  YellPay: YellPayModule,
+  userId: string,
+  { force = false, ttlMs = AUTH_SESSION_TTL_MS }: { force?: boolean; ttlMs?: number } = {},
+): Promise<CachedAuthApproval> {
+  if (!force) {
+    const live = approvedInProcess.get(userId);
+    if (live && live.expiresAt > Date.now()) {
+      return { status: live.status, userInfo: live.userInfo, expiresAt: live.expiresAt, cached: true };
+    }
+
+    const stored = await getCachedAuthSession(userId);
+    if (stored) {
+      const revalidation = approve(YellPay, userId, ttlMs);
+      // Callers that only show the hint may never await it
+      revalidation.catch((error) => console.warn('Background auth approval failed:', error));
+      return { ...stored, revalidation };
+    }
+  }
+
+  return approve(YellPay, userId, ttlMs);
+}
@@ -0,0 +1,154 @@
+/**
+ * YellPay Payment Flow Planner
+ * Table-driven selection of the RoutePay payment flow variant (cash, reception,
+ * PPPAY, scheme) so screens know what the pay tap will need before it happens.
+ *
+ * The SDK still makes the final decision inside its own UI; the plan here only
+ * mirrors its PayCash* / PayCashConfirmation* storyboards so the data those
+ * screens wait on can be fetched in parallel ahead of time.
+ */
+
+import type { YellPayModule } from '../types/YellPay';
+
+export type PaymentEntry = 'payment' | 'qr' | 'scheme';
+
+export type PaymentVariant = 'cash' | 'reception' | 'pppay' | 'receptionPppay' | 'scheme';
+
+/** Data the variant's screens block on, each mapped to one bridge call (preparePayment also warms the hosts) */
+export type PaymentPrefetch = 'mainCard' | 'limitAmount';
+
+export interface MerchantConfig {
+  serviceId: string;
+  merchantId: string;
+  /** Merchant takes payments at a reception desk (QR entry shows a reception confirmation) */
+  reception?: boolean;
+  /** Merchant settles through PPPAY */
+  pppay?: boolean;
+}
+
+export interface PaymentPlan {
+  entry: PaymentEntry;
+  variant: PaymentVariant;
+  /** SDK storyboards in the order they are presented */
+  screens: string[];
+  prefetch: PaymentPrefetch[];
+}
+
+interface VariantRule {
+  entry?: PaymentEntry;
+  reception?: boolean;
+  pppay?: boolean;
+  variant: PaymentVariant;
+}
+
+// First matching row wins; a field left undefined matches any value
+const VARIANT_RULES: VariantRule[] = [
+  { entry: 'scheme', variant: 'scheme' },
+  { entry: 'qr', reception: true, pppay: true, variant: 'receptionPppay' },
+  { entry: 'qr', reception: true, variant: 'reception' },
+  { pppay: true, variant: 'pppay' },
+  { variant: 'cash' },
+];
+
+const VARIANT_SCREENS: Record<PaymentVariant, string[]> = {
+  cash: ['PayCash', 'PayCashConfirmation', 'PayCashComplete'],
+  reception: ['PayQR', 'PayCashConfirmationForReception', 'PayCashComplete'],
+  pppay: ['PayCashPPPAY', 'PayCashConfirmationPPPAY', 'PayCashCompletePPPAY'],
+  receptionPppay: ['PayQR', 'PayCashConfirmationForReceptionPPPAY', 'PayCashCompletePPPAY'],
+  scheme: ['PayCashScheme', 'PayCashConfirmationScheme', 'PayCashComplete'],
+};
+
+const VARIANT_PREFETCH: Record<PaymentVariant, PaymentPrefetch[]> = {
+  cash: ['mainCard', 'limitAmount'],
+  reception: ['mainCard'],
+  pppay: ['mainCard', 'limitAmount'],
+  receptionPppay: ['mainCard'],
+  scheme: ['mainCard', 'limitAmount'],
+};
+
+const ENTRIES: PaymentEntry[] = ['payment', 'qr', 'scheme'];
+
+export const DEFAULT_MERCHANT_CONFIG: MerchantConfig = {
+  serviceId: 'yellpay',
+  merchantId: 'yellpay',
+};
+
+/**
+ * Resolves the flow variant for one entry point from the rule table
+ */
+export function selectPaymentVariant(entry: PaymentEntry, config: MerchantConfig): PaymentVariant {
+  const rule = VARIANT_RULES.find(
+    (row) =>
+      (row.entry === undefined || row.entry === entry) &&
+      (row.reception === undefined || row.reception === !!config.reception) &&
+      (row.pppay === undefined || row.pppay === !!config.pppay),
+  );
+  return rule ? rule.variant : 'cash';
+}
+
+/**
+ * Builds the plan for every entry point; pure, so it can run once per config
+ */
+export function buildPaymentPlans(config: MerchantConfig): Record<PaymentEntry, PaymentPlan> {
+  const plans = {} as Record<PaymentEntry, PaymentPlan>;
+  ENTRIES.forEach((entry) => {
+    const variant = selectPaymentVariant(entry, config);
+    plans[entry] = {
+      entry,
+      variant,
+      screens: VARIANT_SCREENS[variant],
+      prefetch: VARIANT_PREFETCH[variant],
+    };
+  });
+  return plans;
+}
+
+let currentConfigKey: string | null = null;
+let currentPlans = buildPaymentPlans(DEFAULT_MERCHANT_CONFIG);
+
+/**
+ * Precomputes the plans for the merchant the SDK was initialized with.
+ * Call after initUser*; repeated calls with the same config are free.
+ */
+export function preparePaymentPlans(config: MerchantConfig = DEFAULT_MERCHANT_CONFIG) {
+  const key = `${config.serviceId}|${config.merchantId}|${!!config.reception}|${!!config.pppay}`;
+  if (key !== currentConfigKey) {
+    currentPlans = buildPaymentPlans(config);
+    currentConfigKey = key;
+  }
+  return currentPlans;
+}
+
+export function getPaymentPlan(entry: PaymentEntry): PaymentPlan {
+  return currentPlans[entry];
+}
+
+/**
+ * Fetches everything the plan's screens need in parallel, except steps listed in
+ * `done` (already fetched elsewhere, e.g. the home cold-start batch).
+ * Never rejects: a failed step is reported and left for the SDK to retry.
+ */
+export async function prefetchPaymentPlan(
+  plan: PaymentPlan,
+  YellPay: YellPayModule,
+  userId: string,
+  done: readonly PaymentPrefetch[] = [],
+): Promise<Record<PaymentPrefetch, boolean>> {
+  const steps: Record<PaymentPrefetch, () => Promise<unknown>> = {
+    mainCard: () => YellPay.preparePayment(userId),
+    limitAmount: () => YellPay.getConfirmLimitAmount(userId),
+  };
+
+  const results = await Promise.allSettled(
+    plan.prefetch.map((step) => (done.includes(step) ? Promise.resolve() : steps[step]())),
+  );
+  const status = {} as Record<PaymentPrefetch, boolean>;
+  plan.prefetch.forEach((step, index) => {
+    const result = results[index];
+    status[step] = result.status === 'fulfilled';
+    if (result.status === 'rejected') {
+      console.error(`❌ prefetch ${step} error:`, result.reason);
+    }
+  });
+  return status;
+}
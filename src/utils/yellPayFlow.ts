@@ -4,6 +4,7 @@
  */
 
 import { Platform, Alert } from 'react-native';
+import type { YellPayModule, YellPayUiFlow } from '../types/YellPay';
 
 export interface FlowValidationResult {
   isValid: boolean;
@@ -93,3 +94,28 @@ export function validateAndShowError(
   return true;
 }
 
+export interface UiFlowHandle<T> {
+  /** Settles with the SDK result, or rejects with FLOW_CANCELLED after cancel() */
+  promise: Promise<T>;
+  /** Closes the SDK screens and settles the flow; resolves false if it already finished */
+  cancel: () => Promise<boolean>;
+}
+
+/**
+ * Starts an SDK flow that presents its own screens (registerCard, makePayment,
+ * cardSelect) and returns a handle that can abandon it, e.g. when the screen unmounts
+ */
+export function startUiFlow<T>(
+  YellPay: YellPayModule,
+  flow: YellPayUiFlow,
+  start: () => Promise<T>,
+): UiFlowHandle<T> {
+  return {
+    promise: start(),
+    cancel: () => YellPay.cancelFlow(flow).catch(() => false),
+  };
+}
+
+export function isFlowCancelled(error: any): boolean {
+  return error?.code === 'FLOW_CANCELLED';
+}